@@ -0,0 +1,231 @@
+/******************************************************************************/
+/*!
+\file       ArchetypeStorage.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration and implementation of Archetype and
+  ArchetypeStorage class.
+
+  ArchetypeStorage is an alternative to ComponentArray (per type pools) for
+  ComponentManager. Entities that have the exact same Signature are grouped
+  into an Archetype.
+
+  Each Archetype stores its entities in fixed-size chunks (16 KB).
+  Within a chunk, every component type has its own column (SoA):
+  | EntityID x rows | T1 x rows | T2 x rows | ... |
+
+  Adding or removing a component moves the entity's row to the archetype of
+  the new signature. Rows are always packed, when a row is removed, the last
+  row of the archetype is moved into its spot.
+
+  As components of an entity are stored next to each other in the same chunk,
+  systems can stream multiple columns together with ForEachChunk without any
+  per-entity lookups.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include "ECS.hpp"
+#include "PagedArray.hpp"
+#include "include/Memory/Allocator.hpp"
+#include "include/Logging.hpp"
+
+#include <array>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <utility>
+#include <unordered_map>
+
+namespace Engine
+{
+	// Size of a single chunk of an archetype in bytes
+	const std::size_t ARCHETYPE_CHUNK_SIZE = 16 * 1024;
+
+
+	// Type erased information of a component, used to move rows between archetypes
+	struct ComponentInfo
+	{
+		std::size_t size = 0;
+		std::size_t alignment = 0;
+		void (*MoveConstruct)(void* dst, void* src) = nullptr;
+		void (*Destroy)(void* ptr) = nullptr;
+	};
+
+
+	class Archetype
+	{
+	public:
+		struct Chunk
+		{
+			std::byte* memory = nullptr;
+			std::uint32_t count = 0;
+		};
+
+		EntityID* GetEntities(Chunk& chunk);
+		void* GetComponent(Chunk& chunk, ComponentType type, std::size_t size, std::uint32_t row);
+
+		Signature signature{};
+		std::vector<ComponentType> types{};
+
+		// Byte offset of each component type's column in a chunk (-1 if not part of archetype)
+		std::array<std::int32_t, MAX_COMPONENTS> columnOffsets{};
+
+		std::uint32_t rowsPerChunk = 0;
+		std::size_t chunkSize = 0;
+		std::vector<Chunk> chunks{};
+
+		// Cached archetype to move to when adding/removing a component type
+		std::array<Archetype*, MAX_COMPONENTS> addEdges{};
+		std::array<Archetype*, MAX_COMPONENTS> removeEdges{};
+	};
+
+
+	class ArchetypeStorage
+	{
+	public:
+		ArchetypeStorage(Allocator* allocator_);
+
+		template <typename T>
+		void RegisterComponent(ComponentType type);
+
+		template <typename T, typename... argv>
+		bool AddComponent(EntityID e, ComponentType type, argv... args);
+		bool RemoveComponent(EntityID e, ComponentType type);
+
+		bool HasComponent(EntityID e, ComponentType type) const;
+
+		template <typename T>
+		T* GetComponent(EntityID e, ComponentType type);
+
+		void DestroyEntity(EntityID e);
+		void Free();
+
+		// Calls func(count, EntityID*, Ts*...) for every chunk that contains all of Ts
+		template <typename... Ts, typename Func>
+		void ForEachChunk(const std::array<ComponentType, sizeof...(Ts)>& types, Func func);
+
+	private:
+		struct EntityLocation
+		{
+			Archetype* archetype = nullptr;
+			std::uint32_t chunk = 0;
+			std::uint32_t row = 0;
+		};
+
+		Archetype* GetArchetype(const Signature& signature);
+		Archetype* GetTransition(Archetype* from, ComponentType type, bool add);
+
+		// Moves entity's row (and shared components) to archetype dst
+		void MoveEntity(EntityID e, Archetype* dst);
+		void AllocateRow(Archetype* archetype, EntityID e, std::uint32_t& chunk, std::uint32_t& row);
+		// Destroys components at row and moves the last row of archetype into its spot
+		void RemoveRow(Archetype* archetype, std::uint32_t chunk, std::uint32_t row);
+
+		template <typename... Ts, typename Func, std::size_t... I>
+		static void CallChunk(Func& func, Archetype& archetype, Archetype::Chunk& chunk,
+			const std::array<ComponentType, sizeof...(Ts)>& types, std::index_sequence<I...>);
+
+		Allocator* mAllocator = nullptr;
+
+		std::array<ComponentInfo, MAX_COMPONENTS> mComponentInfos{};
+		std::unordered_map<Signature, std::unique_ptr<Archetype>> mArchetypes{};
+
+		// Index corresponds to entity ID
+		PagedArray<EntityLocation, ENTITY_PAGE_SIZE> mLocations{};
+	};
+
+
+	// Templated class functions implementations
+
+	template <typename T>
+	void ArchetypeStorage::RegisterComponent(ComponentType type)
+	{
+		ComponentInfo& info = mComponentInfos[type];
+		info.size = sizeof(T);
+		info.alignment = alignof(T);
+		info.MoveConstruct = [](void* dst, void* src) { new (dst) T(std::move(*reinterpret_cast<T*>(src))); };
+		info.Destroy = [](void* ptr) { reinterpret_cast<T*>(ptr)->~T(); };
+	}
+
+
+	template <typename T, typename... argv>
+	bool ArchetypeStorage::AddComponent(EntityID e, ComponentType type, argv... args)
+	{
+		LOG_ASSERT(e < MAX_ENTITIES && "Entity is out of range.");
+
+		mLocations.Resize(static_cast<std::size_t>(e) + 1);
+		Archetype* src = mLocations[e].archetype;
+		if (src && src->signature.test(type))
+		{
+			LOG_WARNING("Repeated component added to same entity.");
+			return false;
+		}
+
+		MoveEntity(e, GetTransition(src, type, true));
+
+		// Explicitly calls constructor in the new archetype's column
+		EntityLocation& location = mLocations[e];
+		Archetype::Chunk& chunk = location.archetype->chunks[location.chunk];
+		new (location.archetype->GetComponent(chunk, type, sizeof(T), location.row)) T(args ...);
+
+		return true;
+	}
+
+
+	template <typename T>
+	T* ArchetypeStorage::GetComponent(EntityID e, ComponentType type)
+	{
+		if (!HasComponent(e, type))
+		{
+			LOG_WARNING("Retrieving non-existent component.");
+			return nullptr;
+		}
+
+		EntityLocation& location = mLocations[e];
+		Archetype::Chunk& chunk = location.archetype->chunks[location.chunk];
+		return reinterpret_cast<T*>(location.archetype->GetComponent(chunk, type, sizeof(T), location.row));
+	}
+
+
+	template <typename... Ts, typename Func>
+	void ArchetypeStorage::ForEachChunk(const std::array<ComponentType, sizeof...(Ts)>& types, Func func)
+	{
+		Signature required{};
+		for (ComponentType type : types)
+		{
+			required.set(type);
+		}
+
+		for (auto& [signature, archetype] : mArchetypes)
+		{
+			if (!signature.Contains(required))
+			{
+				continue;
+			}
+
+			for (Archetype::Chunk& chunk : archetype->chunks)
+			{
+				CallChunk<Ts...>(func, *archetype, chunk, types, std::index_sequence_for<Ts...>{});
+			}
+		}
+	}
+
+
+	template <typename... Ts, typename Func, std::size_t... I>
+	void ArchetypeStorage::CallChunk(Func& func, Archetype& archetype, Archetype::Chunk& chunk,
+		const std::array<ComponentType, sizeof...(Ts)>& types, std::index_sequence<I...>)
+	{
+		func(static_cast<std::size_t>(chunk.count), archetype.GetEntities(chunk),
+			reinterpret_cast<Ts*>(chunk.memory + archetype.columnOffsets[types[I]])...);
+	}
+
+} // end of namespace
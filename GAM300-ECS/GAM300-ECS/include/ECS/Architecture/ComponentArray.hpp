@@ -6,7 +6,7 @@
 \param      GAM 300
 \date       18 August 2022
 \brief
-  This file contains the declaration and implementation of IComponentArray and 
+  This file contains the declaration and implementation of IComponentArray and
   ComponentArray class.
 
   IComponentArray is used as an interface for ComponentManager class. It is to
@@ -14,15 +14,46 @@
   needs to update its array mappings.
 
   ComponentArray is a data structure that is always packed (no gaps).
-  - Array should be packed so that we are able to iterate through the array 
+  - Array should be packed so that we are able to iterate through the array
   without any "If (valid)" checks.
 
-  To prevent stale data with no entity attached, it is mapped from entity IDs 
-  to array indices:
-  - When accessing the array, it uses the entity ID to look up the actual array
-  index. 
-  - When an entity is destroyed, it takes the last valid element in the
-  array and move into deleted entity's spot and updates the map.
+  It is laid out as a sparse set:
+  - Dense array of T components, split into pages allocated from the allocator
+  (COMPONENT_PAGE_SIZE bytes each, a new page is allocated when the last one is full).
+  - Dense array of entity IDs, where index i is the owner of component i.
+  - Sparse array indexed by entity ID, storing the component's dense index
+  (PagedArray, grows with the highest entity ID that has the component).
+
+  When accessing the array, it uses the entity ID to index the sparse array
+  and get the actual array index (no hashing).
+  When a component is removed, it takes the last valid element in the array
+  and move into removed component's spot and updates the sparse array.
+
+  Pages are only allocated as components are added (or reserved), a pool of a
+  component type that no entity has takes no component memory. Pages that
+  become empty are kept for reuse, until ReleaseEmptyPages frees them.
+
+  Components end up in the order they were added and moved around by removals.
+  BeginSort relocates them into a given order of entities (Eg: entity ID order,
+  hierarchy order, or the order of another component's array), so components
+  of different types can be streamed together with matching access patterns.
+  Sorting is incremental, SortStep places a bounded number of components per
+  call (Swap into place), so it can be spread over several frames.
+  - Components added while sorting stay after the sorted ones.
+  - Removing a sorted component while sorting moves the sort back to its
+  spot, components placed after it are placed again by the next steps.
+
+  Snapshot copies the components and both arrays of indices, Restore replaces
+  them with a snapshot's (See Coordinator::Snapshot). Trivially copyable
+  components are copied with a memcpy per page, others are copy constructed
+  one by one. Snapshots of components that are not copyable fail. Pages are
+  allocated by PrepareRestore before Restore touches the current components,
+  so running out of memory leaves them as they are.
+
+  Use GetPage(0 .. GetPageCount() - 1) and GetEntities() to stream through the
+  components linearly. Growing never moves existing components, but pointers to
+  components are only valid until the next component of the same type is
+  removed (elements are moved to stay packed).
 
   Copyright (C) 2022 DigiPen Institure of Technology.
   Reproduction or disclosure of this file or its contents
@@ -34,25 +65,66 @@
 
 #include "ECS.hpp"
 #include "EntityManager.hpp"
-#include "include/Memory/CustomAllocator.hpp"
+#include "PagedArray.hpp"
+#include "include/Memory/Allocator.hpp"
 #include "include/Logging.hpp"
-#include <unordered_map>
+
+#include <vector>
+#include <span>
+#include <limits>
+#include <utility>
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <cstring>
+#include <type_traits>
 
 namespace Engine
 {
+	// Size of a single page of components in bytes
+	const std::size_t COMPONENT_PAGE_SIZE = 16 * 1024;
+
+
+	// Copy of a component array's state, taken by IComponentArray::Snapshot
+	struct ComponentArraySnapshot
+	{
+		virtual ~ComponentArraySnapshot() = default;
+
+		// Owners of the components, in the array's order
+		std::vector<EntityID> entities{};
+		// Index corresponds to entity ID, value is the index of its component
+		PagedArray<std::uint32_t, ENTITY_PAGE_SIZE> sparse{};
+	};
+
+
 	class IComponentArray
 	{
 	public:
 		virtual ~IComponentArray() = default;
 		virtual void EntityDestroyed(Entity& e) = 0;
 		virtual void EntityDestroyed(EntityID& e) = 0;
+		virtual void EntitiesDestroyed(std::span<const EntityID> entities) = 0;
 		virtual void FreeComponentArray() = 0;
+		// Frees pages without components, returns number of pages freed
+		virtual std::size_t ReleaseEmptyPages() = 0;
+		// Continues sorting (See ComponentArray::BeginSort), returns true once sorted or not sorting
+		virtual bool SortStep(std::size_t maxSteps) = 0;
+
+		// Copies the array into snapshot (Created if nullptr, else its memory is reused)
+		// Returns false if the component is not copyable
+		virtual bool Snapshot(std::unique_ptr<ComponentArraySnapshot>& snapshot) const = 0;
+		// Allocates the pages needed to restore snapshot, components are left as they are
+		virtual bool PrepareRestore(const ComponentArraySnapshot& snapshot) = 0;
+		// Replaces all components with snapshot's, which must be taken from an array of the same type
+		virtual bool Restore(const ComponentArraySnapshot& snapshot) = 0;
+
+		// Whether entity has a component in the array
+		virtual bool Contains(EntityID e) const = 0;
 	};
 
 
 	// T - Component Type
-	// N - Number of elements per chunk.
-	template <typename T, unsigned N>
+	template <typename T>
 	class ComponentArray : public IComponentArray
 	{
 	public:
@@ -66,182 +138,590 @@ namespace Engine
 		void RemoveComponent(Entity& e);
 		void RemoveComponent(EntityID& e);
 
+		// Appends copies of prototype for entities (None of them may have T yet) as one block
+		// Returns number of components added, the entities after those did not fit in storage
+		std::size_t AddComponents(std::span<const EntityID> entities, const T& prototype);
+
+		// Allocates pages so count more components can be added without allocating
+		bool Reserve(std::size_t count);
+
 		bool HasData(Entity& e);
 		bool HasData(EntityID& e);
 
 		T* GetData(const Entity& e);
 		T* GetData(EntityID& e);
 
+		// No checks, entity must have the component (Used by views)
+		T& Get(EntityID e);
+
 		void EntityDestroyed(Entity& e) override;
 		void EntityDestroyed(EntityID& e) override;
+		void EntitiesDestroyed(std::span<const EntityID> entities) override;
 		void FreeComponentArray() override;
+		std::size_t ReleaseEmptyPages() override;
+		bool SortStep(std::size_t maxSteps) override;
+		bool Snapshot(std::unique_ptr<ComponentArraySnapshot>& snapshot) const override;
+		bool PrepareRestore(const ComponentArraySnapshot& snapshot) override;
+		bool Restore(const ComponentArraySnapshot& snapshot) override;
+		bool Contains(EntityID e) const override;
+
+		// Linear access to the packed components, page by page
+		std::size_t Size() const;
+		std::size_t GetPageCount() const;
+		std::span<T> GetPage(std::size_t page);
+
+		// Entities of page p starts at GetEntities()[p * COMPONENTS_PER_PAGE]
+		std::span<const EntityID> GetEntities() const;
+
+		// Starts sorting components into the order of entities in order (Entities without
+		// the component are skipped), replaces the sort in progress. Done by SortStep.
+		void BeginSort(std::vector<EntityID> order);
+		// Starts sorting components by comp(EntityID a, EntityID b) (Strict weak ordering)
+		template <typename Compare>
+		void BeginSort(Compare comp);
+		bool IsSorting() const;
+
+		// Number of T in a page (Largest power of 2 that fits COMPONENT_PAGE_SIZE, at least 1)
+		static constexpr std::size_t COMPONENTS_PER_PAGE = std::bit_floor((std::max)(COMPONENT_PAGE_SIZE / sizeof(T), std::size_t{ 1 }));
 
 	private:
-		// Packed array of T component.
-		CustomAllocator<T, N>* mComponentArrayAllocator = nullptr;
-		std::unordered_map<EntityID, T*> EntityComponentMap{};
+		static constexpr std::uint32_t INVALID_INDEX = (std::numeric_limits<std::uint32_t>::max)();
+
+		struct ArraySnapshot : ComponentArraySnapshot
+		{
+			std::vector<std::byte> bytes{}; // Trivially copyable T, packed components
+			std::vector<T> objects{};       // Other T
+		};
+
+		// Component at dense index
+		T* At(std::uint32_t index);
+		const T* At(std::uint32_t index) const;
+
+		// Appends a page of COMPONENTS_PER_PAGE components
+		bool AllocatePage();
+		// Appends pages until count components fit
+		bool AllocatePages(std::size_t count);
+
+		// Swaps components (and their owners) at dense indices a and b
+		void Swap(std::uint32_t a, std::uint32_t b);
+
+		Allocator* mAllocator = nullptr;
+
+		// Pages of packed T components, component i is in page i / COMPONENTS_PER_PAGE.
+		std::vector<T*> mPages{};
+
+		// Packed array of entity IDs, mDenseEntities[i] owns component i.
+		std::vector<EntityID> mDenseEntities{};
+
+		// Index corresponds to entity ID, value is the index of its component.
+		PagedArray<std::uint32_t, ENTITY_PAGE_SIZE> mSparse{ INVALID_INDEX };
+
+		// Sort in progress, mSortOrder[mSortNext] is the next entity to be placed at mSortCursor
+		std::vector<EntityID> mSortOrder{};
+		std::size_t mSortNext = 0;
+		std::uint32_t mSortCursor = 0;
 	};
 
 
 	// Templated class functions implementations
 
-	template <typename T, unsigned N>
-	ComponentArray<T, N>::ComponentArray(Allocator* allocator_)
+	template <typename T>
+	ComponentArray<T>::ComponentArray(Allocator* allocator_) : mAllocator{ allocator_ }
+	{
+	}
+
+
+	template <typename T>
+	template <typename... argv>
+	bool ComponentArray<T>::AddComponent(Entity& e, argv... args)
 	{
-		mComponentArrayAllocator = new CustomAllocator<T, N>(allocator_);
+		EntityID id = e.GetEntityID();
+		return AddComponent(id, args ...);
 	}
 
 
-	template <typename T, unsigned N>
+	template <typename T>
 	template <typename... argv>
-	bool ComponentArray<T, N>::AddComponent(Entity& e, argv... args)
+	bool ComponentArray<T>::AddComponent(EntityID& e, argv... args)
 	{
-		if (EntityComponentMap.find(e.GetEntityID()) != EntityComponentMap.end())
+		LOG_ASSERT(e < MAX_ENTITIES && "Entity is out of range.");
+
+		if (HasData(e))
 		{
 			LOG_WARNING("Repeated component added to same entity.");
 			return false;
 		}
 
-		T* component = mComponentArrayAllocator->Allocate(args ...);
-		if (component == nullptr)
+		// Allocate a new page once the last page is full
+		const std::uint32_t index = static_cast<std::uint32_t>(mDenseEntities.size());
+		if (index == mPages.size() * COMPONENTS_PER_PAGE && !AllocatePage())
 		{
 			return false;
 		}
+		mSparse.Resize(static_cast<std::size_t>(e) + 1);
+
+		// Explicitly calls constructor at the end of the packed array
+		new (At(index)) T(args ...);
 
-		EntityComponentMap[e.GetEntityID()] = component;
+		mDenseEntities.emplace_back(e);
+		mSparse[e] = index;
 		return true;
 	}
 
 
-	template <typename T, unsigned N>
-	template <typename... argv>
-	bool ComponentArray<T, N>::AddComponent(EntityID& e, argv... args)
+	template <typename T>
+	std::size_t ComponentArray<T>::AddComponents(std::span<const EntityID> entities, const T& prototype)
 	{
-		if (EntityComponentMap.find(e) != EntityComponentMap.end())
+		if (entities.empty())
 		{
-			LOG_WARNING("Repeated component added to same entity.");
-			return false;
+			return 0;
 		}
 
-		T* component = mComponentArrayAllocator->Allocate(args ...);
-		if (component == nullptr)
+		const std::size_t first = mDenseEntities.size();
+		std::size_t count = entities.size();
+		if (!AllocatePages(first + count))
 		{
-			return false;
+			count = mPages.size() * COMPONENTS_PER_PAGE - first;
+			if (count == 0)
+			{
+				return 0;
+			}
 		}
 
-		EntityComponentMap[e] = component;
-		return true;
+		mSparse.Resize(static_cast<std::size_t>(*std::max_element(entities.begin(), entities.begin() + count)) + 1);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			new (At(static_cast<std::uint32_t>(first + i))) T(prototype);
+			mSparse[entities[i]] = static_cast<std::uint32_t>(first + i);
+		}
+		mDenseEntities.insert(mDenseEntities.end(), entities.begin(), entities.begin() + count);
+
+		return count;
+	}
+
+
+	template <typename T>
+	bool ComponentArray<T>::Reserve(std::size_t count)
+	{
+		const std::size_t size = mDenseEntities.size() + count;
+		mDenseEntities.reserve(size);
+
+		return AllocatePages(size);
 	}
 
 
-	template <typename T, unsigned N>
-	void ComponentArray<T, N>::RemoveComponent(Entity& e)
+	template <typename T>
+	void ComponentArray<T>::RemoveComponent(Entity& e)
 	{
-		if (EntityComponentMap.find(e.GetEntityID()) == EntityComponentMap.end())
+		EntityID id = e.GetEntityID();
+		RemoveComponent(id);
+	}
+
+
+	template <typename T>
+	void ComponentArray<T>::RemoveComponent(EntityID& e)
+	{
+		if (!HasData(e))
 		{
 			LOG_WARNING("Removing non-existent component.");
 			return;
 		}
 
-		T* component = GetData(e);
-		EntityComponentMap.erase(e.GetEntityID());
-		mComponentArrayAllocator->Free(component);
+		// Move last element into removed element's spot to keep array packed
+		const std::uint32_t index = mSparse[e];
+		const std::uint32_t last = static_cast<std::uint32_t>(mDenseEntities.size() - 1);
+
+		// The last element would break the sorted part, entities placed after e are placed again
+		if (!mSortOrder.empty() && index < mSortCursor)
+		{
+			while (mSortNext > 0 && mSortOrder[mSortNext - 1] != e)
+			{
+				--mSortNext;
+			}
+			mSortCursor = index;
+		}
+		if (index != last)
+		{
+			*At(index) = std::move(*At(last));
+
+			EntityID moved = mDenseEntities[last];
+			mDenseEntities[index] = moved;
+			mSparse[moved] = index;
+		}
+
+		// Explicitly calls destructor for the (now unused) last element
+		At(last)->~T();
+		mDenseEntities.pop_back();
+		mSparse[e] = INVALID_INDEX;
 	}
 
 
-	template <typename T, unsigned N>
-	void ComponentArray<T, N>::RemoveComponent(EntityID& e)
+	template <typename T>
+	bool ComponentArray<T>::HasData(Entity& e)
 	{
-		if (EntityComponentMap.find(e) == EntityComponentMap.end())
+		EntityID id = e.GetEntityID();
+		return HasData(id);
+	}
+
+
+	template <typename T>
+	bool ComponentArray<T>::HasData(EntityID& e)
+	{
+		return e < mSparse.Size() && mSparse[e] != INVALID_INDEX;
+	}
+
+
+	template <typename T>
+	bool ComponentArray<T>::Contains(EntityID e) const
+	{
+		return e < mSparse.Size() && mSparse[e] != INVALID_INDEX;
+	}
+
+
+	template <typename T>
+	T* ComponentArray<T>::GetData(const Entity& e)
+	{
+		EntityID id = e.GetEntityID();
+		return GetData(id);
+	}
+
+
+	template <typename T>
+	T* ComponentArray<T>::GetData(EntityID& e)
+	{
+		if (!HasData(e))
 		{
-			LOG_WARNING("Removing non-existent component.");
-			return;
+			LOG_WARNING("Retrieving non-existent component.");
+			return nullptr;
 		}
 
-		T* component = GetData(e);
-		EntityComponentMap.erase(e);
-		mComponentArrayAllocator->Free(component);
+		return At(mSparse[e]);
+	}
+
+
+	template <typename T>
+	T& ComponentArray<T>::Get(EntityID e)
+	{
+		return *At(mSparse[e]);
+	}
+
+
+	template <typename T>
+	void ComponentArray<T>::EntityDestroyed(Entity& e)
+	{
+		EntityID id = e.GetEntityID();
+		EntityDestroyed(id);
 	}
 
 
-	template <typename T, unsigned N>
-	bool ComponentArray<T, N>::HasData(Entity& e)
+	template <typename T>
+	void ComponentArray<T>::EntityDestroyed(EntityID& e)
 	{
-		if (EntityComponentMap.find(e.GetEntityID()) == EntityComponentMap.end())
+		if (HasData(e))
 		{
-			return false;
+			RemoveComponent(e);
 		}
+	}
 
-		return true;
+
+	template <typename T>
+	void ComponentArray<T>::EntitiesDestroyed(std::span<const EntityID> entities)
+	{
+		for (EntityID e : entities)
+		{
+			if (mDenseEntities.empty())
+			{
+				return;
+			}
+
+			if (HasData(e))
+			{
+				RemoveComponent(e);
+			}
+		}
 	}
 
 
-	template <typename T, unsigned N>
-	bool ComponentArray<T, N>::HasData(EntityID& e)
+	template <typename T>
+	void ComponentArray<T>::FreeComponentArray()
 	{
-		if (EntityComponentMap.find(e) == EntityComponentMap.end())
+		for (std::uint32_t i = 0; i < mDenseEntities.size(); ++i)
+		{
+			At(i)->~T();
+		}
+		mDenseEntities.clear();
+		mSparse.Clear();
+		mSortOrder.clear();
+		mSortNext = 0;
+
+		for (T* page : mPages)
+		{
+			mAllocator->Free(page);
+		}
+		mPages.clear();
+	}
+
+
+	template <typename T>
+	std::size_t ComponentArray<T>::ReleaseEmptyPages()
+	{
+		// Only pages after the last used one can be empty (Array is packed)
+		const std::size_t used = GetPageCount();
+		const std::size_t released = mPages.size() - used;
+		for (std::size_t i = used; i < mPages.size(); ++i)
+		{
+			mAllocator->Free(mPages[i]);
+		}
+		mPages.resize(used);
+		mDenseEntities.shrink_to_fit();
+
+		return released;
+	}
+
+
+	template <typename T>
+	std::size_t ComponentArray<T>::Size() const
+	{
+		return mDenseEntities.size();
+	}
+
+
+	template <typename T>
+	std::size_t ComponentArray<T>::GetPageCount() const
+	{
+		return (mDenseEntities.size() + COMPONENTS_PER_PAGE - 1) / COMPONENTS_PER_PAGE;
+	}
+
+
+	template <typename T>
+	std::span<T> ComponentArray<T>::GetPage(std::size_t page)
+	{
+		// Only the last page can be partially filled
+		const std::size_t first = page * COMPONENTS_PER_PAGE;
+		const std::size_t count = (std::min)(COMPONENTS_PER_PAGE, mDenseEntities.size() - first);
+		return std::span<T>(mPages[page], count);
+	}
+
+
+	template <typename T>
+	std::span<const EntityID> ComponentArray<T>::GetEntities() const
+	{
+		return std::span<const EntityID>(mDenseEntities.data(), mDenseEntities.size());
+	}
+
+
+	template <typename T>
+	void ComponentArray<T>::BeginSort(std::vector<EntityID> order)
+	{
+		mSortOrder = std::move(order);
+		mSortNext = 0;
+		mSortCursor = 0;
+	}
+
+
+	template <typename T>
+	template <typename Compare>
+	void ComponentArray<T>::BeginSort(Compare comp)
+	{
+		std::vector<EntityID> order(mDenseEntities.begin(), mDenseEntities.end());
+		std::sort(order.begin(), order.end(), comp);
+		BeginSort(std::move(order));
+	}
+
+
+	template <typename T>
+	bool ComponentArray<T>::IsSorting() const
+	{
+		return mSortNext < mSortOrder.size();
+	}
+
+
+	template <typename T>
+	bool ComponentArray<T>::SortStep(std::size_t maxSteps)
+	{
+		for (std::size_t step = 0; step < maxSteps && IsSorting(); ++step)
+		{
+			EntityID e = mSortOrder[mSortNext++];
+			if (!Contains(e))
+			{
+				continue;
+			}
+
+			// Components before the cursor are already placed
+			const std::uint32_t index = mSparse[e];
+			if (index < mSortCursor)
+			{
+				continue;
+			}
+
+			if (index != mSortCursor)
+			{
+				Swap(mSortCursor, index);
+			}
+			++mSortCursor;
+		}
+
+		if (IsSorting())
 		{
 			return false;
 		}
 
+		// Release the order once done
+		mSortOrder = std::vector<EntityID>{};
+		mSortNext = 0;
 		return true;
 	}
 
 
-	template <typename T, unsigned N>
-	T* ComponentArray<T, N>::GetData(const Entity& e)
+	template <typename T>
+	bool ComponentArray<T>::Snapshot(std::unique_ptr<ComponentArraySnapshot>& snapshot) const
 	{
-		if (EntityComponentMap.find(e.GetEntityID()) == EntityComponentMap.end())
+		if constexpr (!std::is_copy_constructible_v<T>)
 		{
-			LOG_WARNING("Retrieving non-existent component.");
-			return nullptr;
+			LOG_WARNING("Snapshotting component that is not copyable.");
+			return false;
+		}
+
+		if (snapshot == nullptr)
+		{
+			snapshot = std::make_unique<ArraySnapshot>();
 		}
+		ArraySnapshot& target = static_cast<ArraySnapshot&>(*snapshot);
+
+		target.entities = mDenseEntities;
+		target.sparse = mSparse;
 
-		return EntityComponentMap[e.GetEntityID()];
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			target.bytes.resize(mDenseEntities.size() * sizeof(T));
+			for (std::size_t page = 0; page < GetPageCount(); ++page)
+			{
+				const std::size_t first = page * COMPONENTS_PER_PAGE;
+				const std::size_t count = (std::min)(COMPONENTS_PER_PAGE, mDenseEntities.size() - first);
+				std::memcpy(target.bytes.data() + first * sizeof(T), mPages[page], count * sizeof(T));
+			}
+		}
+		else if constexpr (std::is_copy_constructible_v<T>)
+		{
+			target.objects.clear();
+			target.objects.reserve(mDenseEntities.size());
+			for (std::uint32_t i = 0; i < mDenseEntities.size(); ++i)
+			{
+				target.objects.emplace_back(*At(i));
+			}
+		}
+		return true;
 	}
 
 
-	template <typename T, unsigned N>
-	T* ComponentArray<T, N>::GetData(EntityID& e)
+	template <typename T>
+	bool ComponentArray<T>::PrepareRestore(const ComponentArraySnapshot& snapshot)
 	{
-		if (EntityComponentMap.find(e) == EntityComponentMap.end())
+		if constexpr (!std::is_copy_constructible_v<T>)
 		{
-			LOG_WARNING("Retrieving non-existent component.");
-			return nullptr;
+			return false;
 		}
 
-		return EntityComponentMap[e];
+		return AllocatePages(snapshot.entities.size());
 	}
 
 
-	template <typename T, unsigned N>
-	void ComponentArray<T, N>::EntityDestroyed(Entity& e)
+	template <typename T>
+	bool ComponentArray<T>::Restore(const ComponentArraySnapshot& snapshot)
 	{
-		if (EntityComponentMap.find(e.GetEntityID()) != EntityComponentMap.end())
+		// Fails before the existing components are touched
+		if (!PrepareRestore(snapshot))
 		{
-			RemoveComponent(e);
+			return false;
+		}
+
+		const ArraySnapshot& source = static_cast<const ArraySnapshot&>(snapshot);
+
+		// Existing components are destroyed, their pages are reused
+		for (std::uint32_t i = 0; i < mDenseEntities.size(); ++i)
+		{
+			At(i)->~T();
+		}
+		mDenseEntities.clear();
+		mSortOrder.clear();
+		mSortNext = 0;
+
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			for (std::size_t first = 0; first < source.entities.size(); first += COMPONENTS_PER_PAGE)
+			{
+				const std::size_t count = (std::min)(COMPONENTS_PER_PAGE, source.entities.size() - first);
+				std::memcpy(mPages[first / COMPONENTS_PER_PAGE], source.bytes.data() + first * sizeof(T), count * sizeof(T));
+			}
 		}
+		else if constexpr (std::is_copy_constructible_v<T>)
+		{
+			for (std::uint32_t i = 0; i < source.entities.size(); ++i)
+			{
+				new (At(i)) T(source.objects[i]);
+			}
+		}
+
+		mDenseEntities = source.entities;
+		mSparse = source.sparse;
+		return true;
+	}
+
+
+	template <typename T>
+	void ComponentArray<T>::Swap(std::uint32_t a, std::uint32_t b)
+	{
+		using std::swap;
+		swap(*At(a), *At(b));
+
+		std::swap(mDenseEntities[a], mDenseEntities[b]);
+		mSparse[mDenseEntities[a]] = a;
+		mSparse[mDenseEntities[b]] = b;
+	}
+
+
+	template <typename T>
+	T* ComponentArray<T>::At(std::uint32_t index)
+	{
+		return mPages[index / COMPONENTS_PER_PAGE] + index % COMPONENTS_PER_PAGE;
+	}
+
+
+	template <typename T>
+	const T* ComponentArray<T>::At(std::uint32_t index) const
+	{
+		return mPages[index / COMPONENTS_PER_PAGE] + index % COMPONENTS_PER_PAGE;
 	}
 
 
-	template <typename T, unsigned N>
-	void ComponentArray<T, N>::EntityDestroyed(EntityID& e)
+	template <typename T>
+	bool ComponentArray<T>::AllocatePage()
 	{
-		if (EntityComponentMap.find(e) != EntityComponentMap.end())
+		// FreeListAllocator requires alignment of at least 8
+		const std::size_t alignment = (std::max)(alignof(T), std::size_t{ 8 });
+		T* page = reinterpret_cast<T*>(mAllocator->Allocate(sizeof(T) * COMPONENTS_PER_PAGE, alignment));
+		if (page == nullptr)
 		{
-			RemoveComponent(e);
+			LOG_WARNING("Component array is full.");
+			return false;
 		}
+
+		mPages.emplace_back(page);
+		return true;
 	}
 
 
-	template <typename T, unsigned N>
-	void ComponentArray<T, N>::FreeComponentArray()
+	template <typename T>
+	bool ComponentArray<T>::AllocatePages(std::size_t count)
 	{
-		if (mComponentArrayAllocator)
+		while (mPages.size() * COMPONENTS_PER_PAGE < count)
 		{
-			delete mComponentArrayAllocator;
-			mComponentArrayAllocator = nullptr;
+			if (!AllocatePage())
+			{
+				return false;
+			}
 		}
+		return true;
 	}
 
-} // end of namespace
\ No newline at end of file
+} // end of namespace
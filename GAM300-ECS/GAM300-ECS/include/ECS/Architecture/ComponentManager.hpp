@@ -14,7 +14,36 @@
   It contains a ComponentType variable that increments by one whenever a component
   is registered.
 
-  It also have a unique key which is a map to ComponentArray to the ComponentType
+  Every component type T is given a dense static ID by TypeID<IComponent>, which
+  indexes a flat container of ComponentType and ComponentArray (no hashing of
+  typeid(T).name() on every access).
+
+  Components can be stored in either of the storage modes (Chosen at construction):
+  - StorageMode::Pool, each component type has its own packed ComponentArray.
+  - StorageMode::Archetype, entities with the same signature share 16 KB chunks
+  where each component type is a column (See ArchetypeStorage.hpp).
+  GetComponentArray is only valid for StorageMode::Pool, and ForEachChunk is 
+  only valid for StorageMode::Archetype.
+
+  StorageMode::Archetype is experimental. Pool only features (Snapshot/Restore,
+  Reserve, Compact/Sort/SortAs) assert in it, and views look up each component
+  by entity instead of indexing its array (See ComponentView::Get).
+
+  Every entity's component has a version, the change tick of its last
+  non-const access (GetComponent<T>, AddComponent). GetComponent<const T>
+  does not change the version. Versions are indexed by entity, so they work
+  the same in both storage modes.
+
+  Observers can be registered for a component type's events (Add, Remove and
+  Set by ReplaceComponent). Events are not delivered when they happen, they
+  are queued in the type's ring buffer (Only if the event has observers) and
+  DispatchEvents calls each observer once per run of consecutive entities
+  with the same event, in the order they happened. Removed components can no
+  longer be accessed by the time their event is delivered. Observers
+  registered by an observer are added once DispatchEvents is done.
+
+  Compact/Sort/SortAs relocate a type's components into an order of entities
+  over several SortStep calls (StorageMode::Pool, see ComponentArray.hpp).
 
   Copyright (C) 2022 DigiPen Institure of Technology.
   Reproduction or disclosure of this file or its contents
@@ -27,95 +56,303 @@
 #include "ECS.hpp"
 #include "EntityManager.hpp"
 #include "ComponentArray.hpp"
-
-#include <unordered_map>
+#include "ArchetypeStorage.hpp"
+#include "TypeID.hpp"
+#include "IComponent.hpp"
+#include "RingBuffer.hpp"
+
+#include <span>
+#include <algorithm>
+#include <array>
+#include <vector>
 #include <memory>
+#include <atomic>
+#include <functional>
+#include <type_traits>
 
 namespace Engine
 {
+	enum class StorageMode
+	{
+		Pool,     // Per component type packed arrays
+		Archetype // Per signature chunks of component columns (Experimental, see ComponentManager)
+	};
+
+
+	enum class ComponentEvent : std::uint8_t
+	{
+		Add,    // Component added to entity
+		Remove, // Component removed from entity, or entity destroyed
+		Set,    // Component replaced through ReplaceComponent
+		Count
+	};
+
+
+	// Called with a batch of entities that had the same event, in the order they happened
+	using ComponentObserver = std::function<void(std::span<const EntityID> entities)>;
+
+	// Copies of the component arrays, index corresponds to TypeID<IComponent> (nullptr if not registered)
+	struct ComponentSnapshot
+	{
+		std::vector<std::unique_ptr<ComponentArraySnapshot>> arrays{};
+	};
+
+
 	class ComponentManager
 	{
 	public:
-		template<typename T, unsigned N>
-		void RegisterComponent(Allocator* allocator_);
+		ComponentManager(StorageMode mode = StorageMode::Pool);
+
+		// Pools grow by pages from allocator_ as components are added.
+		// capacityHint - Number of components to allocate pages for up front (StorageMode::Pool only)
+		template<typename T>
+		void RegisterComponent(Allocator* allocator_, std::size_t capacityHint = 0);
 
 		template<typename T>
 		ComponentType GetComponentType();
 
-		template<typename T, unsigned N, typename... argv>
+		// Returns false if T is not registered, else type is set to T's ComponentType
+		template<typename T>
+		bool FindComponentType(ComponentType& type);
+
+		template<typename T, typename... argv>
 		bool AddComponent(Entity& e, argv... args);
-		template<typename T, unsigned N, typename... argv>
+		template<typename T, typename... argv>
 		bool AddComponent(EntityID& e, argv... args);
+		// Adds copies of prototype to entities that do not have T yet (One block for StorageMode::Pool)
+		// Returns number of components added, in the span's order
+		template<typename T>
+		std::size_t AddComponents(std::span<const EntityID> entities, const T& prototype);
 
-		template<typename T, unsigned N>
+		template<typename T>
 		void RemoveComponent(Entity& e);
-		template<typename T, unsigned N>
+		template<typename T>
 		void RemoveComponent(EntityID& e);
 
-		template<typename T, unsigned N = 1>
+		// Assigns T(args...) to entity's existing T component
+		template<typename T, typename... argv>
+		bool ReplaceComponent(EntityID e, argv... args);
+
+		// Allocates storage for count more components of T (StorageMode::Pool only)
+		template<typename T>
+		void Reserve(std::size_t count);
+
+		// Starts relocating T's components for iteration locality, the components are moved
+		// by SortStep calls (StorageMode::Pool only, see ComponentArray::BeginSort)
+		// Into ascending entity ID order
+		template<typename T>
+		void Compact();
+		// Into comp(EntityID a, EntityID b) order
+		template<typename T, typename Compare>
+		void Sort(Compare comp);
+		// Into the order of entities in order (Eg: Hierarchy::GetOrder)
+		template<typename T>
+		void SortAs(std::span<const EntityID> order);
+		// Into the current order of U's components (Entities without U are placed last)
+		template<typename T, typename U>
+		void SortAs();
+		// Places up to maxSteps components of each array being sorted, returns true if all are sorted
+		// (Always sorted for StorageMode::Archetype)
+		bool SortStep(std::size_t maxSteps);
+
+		template<typename T>
 		bool HasComponent(Entity& e);
-		template<typename T, unsigned N = 1>
+		template<typename T>
 		bool HasComponent(EntityID& e);
 
-		template<typename T, unsigned N = 1>
+		// T can be const, which does not change the component's version
+		template<typename T>
 		T* GetComponent(const Entity& e);
-		template<typename T, unsigned N = 1>
+		template<typename T>
 		T* GetComponent(EntityID& e);
 
+		// Current change tick, versions newer than a tick were changed after it
+		Tick GetChangeTick() const;
+		// Starts a new change tick and returns it
+		Tick AdvanceChangeTick();
+
+		// Change tick of the last non-const access of entity's T component
+		template<typename T>
+		Tick GetVersion(EntityID e);
+		// Stamps entity's T component with the current change tick (Thread safe for different entities)
+		template<typename T>
+		void MarkChanged(EntityID e);
+		// Whether any of entity's Ts components changed after tick
+		template<typename... Ts>
+		bool ChangedSince(EntityID e, Tick tick);
+
+		// Observer of T's event, called by DispatchEvents
+		template<typename T>
+		void Observe(ComponentEvent event, ComponentObserver observer);
+		// Delivers the events queued so far, events queued by observers are delivered by the next call
+		void DispatchEvents();
+		// Drops queued events without delivering them
+		void ClearEvents();
+
+		// Get pointer to ComponentArray of type T (For iterating packed components).
+		template<typename T>
+		std::shared_ptr<ComponentArray<T>> GetComponentArray();
+
+		// Calls func(count, EntityID*, Ts*...) for every archetype chunk that has all of Ts
+		template<typename... Ts, typename Func>
+		void ForEachChunk(Func func);
+
+		StorageMode GetStorageMode() const;
+
 		void DestroyEntity(Entity& e);
 		void DestroyEntity(EntityID& e);
+		// Each component array is visited once for all entities
+		void DestroyEntities(std::span<const EntityID> entities);
 
 		void FreeCustomAllocator();
+		// Copies every component array into snapshot, reusing its memory (StorageMode::Pool only)
+		// Fails if a registered component is not copyable
+		bool Snapshot(ComponentSnapshot& snapshot) const;
+		// Replaces every component array with snapshot's, restored components are marked as
+		// changed and queued events are dropped (StorageMode::Pool only)
+		// Nothing is replaced if the arrays can not allocate the pages needed
+		bool Restore(const ComponentSnapshot& snapshot);
+
+		// Frees pool pages that no longer have components, returns number of pages freed
+		// (Archetype chunks are already freed once empty)
+		std::size_t ReleaseEmptyPages();
 
 	private:
-		// Get static pointer to ComponentArray of type T.
-		template<typename T, unsigned N>
-		std::shared_ptr<ComponentArray<T, N>> GetComponentArray();
+		// Raw pointer to ComponentArray of type T (No shared_ptr copy for hot paths)
+		template<typename T>
+		ComponentArray<T>* GetArray();
 
-		// Map type name to component type
-		std::unordered_map<const char*, ComponentType> mComponentTypes{};
+		struct QueuedEvent
+		{
+			EntityID entity;
+			ComponentEvent event;
+		};
+
+		struct ComponentObservers
+		{
+			std::array<std::vector<ComponentObserver>, static_cast<std::size_t>(ComponentEvent::Count)> observers{};
+			RingBuffer<QueuedEvent> events{};
+		};
+
+		struct PendingObserver
+		{
+			std::size_t id;
+			ComponentEvent event;
+			ComponentObserver observer;
+		};
+
+		void AddObserver(std::size_t id, ComponentEvent event, ComponentObserver observer);
+		// Queues event if it has observers
+		void QueueEvent(std::size_t id, ComponentEvent event, EntityID e);
+		// Queues Remove events of observed components that entity has (Before destroying it)
+		void QueueDestroyEvents(EntityID e);
+
+		StorageMode mStorageMode = StorageMode::Pool;
+		std::unique_ptr<ArchetypeStorage> mArchetypeStorage;
 
-		// Map type name to component array
-		std::unordered_map<const char*, std::shared_ptr<IComponentArray>> mComponentArrays{};
+		struct RegisteredComponent
+		{
+			bool isRegistered = false;
+			ComponentType type{};
+			std::shared_ptr<IComponentArray> array; // nullptr for StorageMode::Archetype
+
+			// Index corresponds to EntityID
+			PagedArray<Tick, ENTITY_PAGE_SIZE> versions{ 0 };
+
+			// nullptr until T is observed
+			std::unique_ptr<ComponentObservers> observers;
+		};
+
+		// Index corresponds to TypeID<IComponent>::Get<T>()
+		std::vector<RegisteredComponent> mComponents{};
 
 		// Component type to be assigned to the next registered component
 		ComponentType NextComponentType{};
+
+		// Starts at 1 so components added before any system update count as changed
+		std::atomic<Tick> mChangeTick{ 1 };
+
+		// Entities of the batch being delivered by DispatchEvents
+		std::vector<EntityID> mEventBatch{};
+		// Observers registered during DispatchEvents (Added after it so the observer lists being called are not modified)
+		bool mDispatching = false;
+		std::vector<PendingObserver> mPendingObservers{};
 	};
 
 
 	// Templated functions implementations
 
-	template <typename T, unsigned N>
-	std::shared_ptr<ComponentArray<T, N>> ComponentManager::GetComponentArray()
+	template <typename T>
+	std::shared_ptr<ComponentArray<T>> ComponentManager::GetComponentArray()
 	{
-		const char* name = typeid(T).name();
+		const std::size_t id = TypeID<IComponent>::Get<T>();
 
-		if (mComponentTypes.find(name) == mComponentTypes.end())
+		if (id >= mComponents.size() || mComponents[id].array == nullptr)
 		{
 			LOG_WARNING("Component is not registered.");
 			return nullptr;
 		}
 
-		return std::static_pointer_cast<ComponentArray<T, N>>(mComponentArrays[name]);
+		return std::static_pointer_cast<ComponentArray<T>>(mComponents[id].array);
 	}
 
 
-	template<typename T, unsigned N>
-	void ComponentManager::RegisterComponent(Allocator* allocator_)
+	template <typename T>
+	ComponentArray<T>* ComponentManager::GetArray()
 	{
-		const char* name = typeid(T).name();
+		const std::size_t id = TypeID<IComponent>::Get<T>();
 
-		if (mComponentTypes.find(name) != mComponentTypes.end())
+		if (id >= mComponents.size() || mComponents[id].array == nullptr)
+		{
+			LOG_WARNING("Component is not registered.");
+			return nullptr;
+		}
+
+		return static_cast<ComponentArray<T>*>(mComponents[id].array.get());
+	}
+
+
+	template<typename T>
+	void ComponentManager::RegisterComponent(Allocator* allocator_, std::size_t capacityHint)
+	{
+		const std::size_t id = TypeID<IComponent>::Get<T>();
+
+		if (id < mComponents.size() && mComponents[id].isRegistered)
 		{
 			LOG_WARNING("Registering component more than once.");
 			return;
 		}
 
-		// Add to component type map
-		mComponentTypes.insert({ name, NextComponentType });
+		LOG_ASSERT(NextComponentType < MAX_COMPONENTS && "Number of components exceeds MAX_COMPONENTS");
+
+		if (id >= mComponents.size())
+		{
+			mComponents.resize(id + 1);
+		}
+
+		// Add to component type container
+		RegisteredComponent& component = mComponents[id];
+		component.isRegistered = true;
+		component.type = NextComponentType;
 
-		// Create a ComponentArray pointer and add it to the component arrays map
-		mComponentArrays.insert({ name, std::make_shared<ComponentArray<T, N>>(allocator_) });
+		if (mStorageMode == StorageMode::Archetype)
+		{
+			if (!mArchetypeStorage)
+			{
+				mArchetypeStorage = std::make_unique<ArchetypeStorage>(allocator_);
+			}
+			mArchetypeStorage->RegisterComponent<T>(NextComponentType);
+		}
+		else
+		{
+			// Create a ComponentArray pointer and add it to the component arrays container
+			auto array = std::make_shared<ComponentArray<T>>(allocator_);
+			if (capacityHint > 0 && !array->Reserve(capacityHint))
+			{
+				LOG_WARNING("Unable to reserve component capacity hint.");
+			}
+			component.array = std::move(array);
+		}
 
 		++NextComponentType;
 	}
@@ -124,85 +361,346 @@ namespace Engine
 	template<typename T>
 	ComponentType ComponentManager::GetComponentType()
 	{
-		const char* name = typeid(T).name();
+		const std::size_t id = TypeID<IComponent>::Get<T>();
+
+		LOG_ASSERT(id < mComponents.size() && mComponents[id].isRegistered && "Component not registered.");
+
+		return mComponents[id].type;
+	}
+
+
+	template<typename T>
+	bool ComponentManager::FindComponentType(ComponentType& type)
+	{
+		const std::size_t id = TypeID<IComponent>::Get<T>();
 
-		LOG_ASSERT(mComponentTypes.find(name) != mComponentTypes.end() && "Component not registered.");
+		if (id >= mComponents.size() || !mComponents[id].isRegistered)
+		{
+			return false;
+		}
 
-		return mComponentTypes[name];
+		type = mComponents[id].type;
+		return true;
 	}
 
 
-	template<typename T, unsigned N, typename... argv>
+	template<typename T, typename... argv>
 	bool ComponentManager::AddComponent(Entity& e, argv... args)
 	{
-		// Add component to the array
-		return GetComponentArray<T, N>()->AddComponent(e, args ...);
+		EntityID id = e.GetEntityID();
+		return AddComponent<T>(id, args ...);
 	}
 
 
-	template<typename T, unsigned N, typename... argv>
+	template<typename T, typename... argv>
 	bool ComponentManager::AddComponent(EntityID& e, argv... args)
 	{
-		// Add component to the array
-		return GetComponentArray<T, N>()->AddComponent(e, args ...);
+		bool added = false;
+		if (mStorageMode == StorageMode::Archetype)
+		{
+			// Move entity to the archetype with the new signature
+			added = mArchetypeStorage->AddComponent<T>(e, GetComponentType<T>(), args ...);
+		}
+		else
+		{
+			// Add component to the array
+			added = GetArray<T>()->AddComponent(e, args ...);
+		}
+
+		const std::size_t id = TypeID<IComponent>::Get<T>();
+		if (added && id < mComponents.size())
+		{
+			// New components count as changed
+			PagedArray<Tick, ENTITY_PAGE_SIZE>& versions = mComponents[id].versions;
+			versions.Resize(static_cast<std::size_t>(e) + 1);
+			versions[e] = GetChangeTick();
+
+			QueueEvent(id, ComponentEvent::Add, e);
+		}
+		return added;
 	}
 
 
-	template<typename T, unsigned N>
+	template<typename T>
+	std::size_t ComponentManager::AddComponents(std::span<const EntityID> entities, const T& prototype)
+	{
+		std::size_t added = 0;
+		if (mStorageMode == StorageMode::Archetype)
+		{
+			for (; added < entities.size(); ++added)
+			{
+				if (!mArchetypeStorage->AddComponent<T>(entities[added], GetComponentType<T>(), prototype))
+				{
+					break;
+				}
+			}
+		}
+		else
+		{
+			added = GetArray<T>()->AddComponents(entities, prototype);
+		}
+
+		const std::size_t id = TypeID<IComponent>::Get<T>();
+		if (added > 0 && id < mComponents.size())
+		{
+			// New components count as changed
+			std::span<const EntityID> stamped = entities.first(added);
+			PagedArray<Tick, ENTITY_PAGE_SIZE>& versions = mComponents[id].versions;
+			versions.Resize(static_cast<std::size_t>(*std::max_element(stamped.begin(), stamped.end())) + 1);
+
+			const Tick tick = GetChangeTick();
+			for (EntityID e : stamped)
+			{
+				versions[e] = tick;
+				QueueEvent(id, ComponentEvent::Add, e);
+			}
+		}
+		return added;
+	}
+
+
+	template<typename T>
 	void ComponentManager::RemoveComponent(Entity& e)
 	{
-		// Remove component from the array
-		GetComponentArray<T, N>()->RemoveComponent(e);
+		EntityID id = e.GetEntityID();
+		RemoveComponent<T>(id);
 	}
 
 
-	template<typename T, unsigned N>
+	template<typename T>
 	void ComponentManager::RemoveComponent(EntityID& e)
 	{
+		const std::size_t id = TypeID<IComponent>::Get<T>();
+		if (id < mComponents.size() && mComponents[id].observers && HasComponent<T>(e))
+		{
+			QueueEvent(id, ComponentEvent::Remove, e);
+		}
+
+		if (mStorageMode == StorageMode::Archetype)
+		{
+			// Move entity to the archetype without T
+			mArchetypeStorage->RemoveComponent(e, GetComponentType<T>());
+			return;
+		}
+
 		// Remove component from the array
-		GetComponentArray<T, N>()->RemoveComponent(e);
+		GetArray<T>()->RemoveComponent(e);
 	}
 
 
-	template<typename T, unsigned N>
-	bool ComponentManager::HasComponent(Entity& e)
+	template<typename T, typename... argv>
+	bool ComponentManager::ReplaceComponent(EntityID e, argv... args)
+	{
+		if (!HasComponent<T>(e))
+		{
+			LOG_WARNING("Replacing component that entity does not have.");
+			return false;
+		}
+
+		*GetComponent<T>(e) = T(args ...);
+		QueueEvent(TypeID<IComponent>::Get<T>(), ComponentEvent::Set, e);
+		return true;
+	}
+
+
+	template<typename T>
+	void ComponentManager::Reserve(std::size_t count)
+	{
+		LOG_ASSERT(mStorageMode == StorageMode::Pool && "Reserving components is only supported by StorageMode::Pool.");
+		if (mStorageMode == StorageMode::Pool)
+		{
+			GetArray<T>()->Reserve(count);
+		}
+	}
+
+
+	template<typename T>
+	void ComponentManager::Compact()
+	{
+		Sort<T>(std::less<EntityID>{});
+	}
+
+
+	template<typename T, typename Compare>
+	void ComponentManager::Sort(Compare comp)
 	{
-		// Get a reference to the component
-		if (GetComponentArray<T, N>())
+		LOG_ASSERT(mStorageMode == StorageMode::Pool && "Sorting components is only supported by StorageMode::Pool.");
+		if (mStorageMode != StorageMode::Pool)
 		{
-			return GetComponentArray<T, N>()->HasData(e);
+			LOG_WARNING("Sorting components is only supported by StorageMode::Pool.");
+			return;
 		}
 
-		return false;
+		if (ComponentArray<T>* array = GetArray<T>())
+		{
+			array->BeginSort(comp);
+		}
 	}
 
 
-	template<typename T, unsigned N>
+	template<typename T>
+	void ComponentManager::SortAs(std::span<const EntityID> order)
+	{
+		LOG_ASSERT(mStorageMode == StorageMode::Pool && "Sorting components is only supported by StorageMode::Pool.");
+		if (mStorageMode != StorageMode::Pool)
+		{
+			LOG_WARNING("Sorting components is only supported by StorageMode::Pool.");
+			return;
+		}
+
+		if (ComponentArray<T>* array = GetArray<T>())
+		{
+			array->BeginSort(std::vector<EntityID>(order.begin(), order.end()));
+		}
+	}
+
+
+	template<typename T, typename U>
+	void ComponentManager::SortAs()
+	{
+		LOG_ASSERT(mStorageMode == StorageMode::Pool && "Sorting components is only supported by StorageMode::Pool.");
+		if (mStorageMode != StorageMode::Pool)
+		{
+			LOG_WARNING("Sorting components is only supported by StorageMode::Pool.");
+			return;
+		}
+
+		if (ComponentArray<U>* other = GetArray<U>())
+		{
+			SortAs<T>(other->GetEntities());
+		}
+	}
+
+
+	template<typename T>
+	bool ComponentManager::HasComponent(Entity& e)
+	{
+		EntityID id = e.GetEntityID();
+		return HasComponent<T>(id);
+	}
+
+
+	template<typename T>
 	bool ComponentManager::HasComponent(EntityID& e)
 	{
-		// Get a reference to the component
-		if (GetComponentArray<T, N>())
+		ComponentType type{};
+		if (!FindComponentType<T>(type))
+		{
+			return false;
+		}
+
+		if (mStorageMode == StorageMode::Archetype)
 		{
-			return GetComponentArray<T, N>()->HasData(e);
+			return mArchetypeStorage->HasComponent(e, type);
 		}
 
-		return false;
+		return GetArray<T>()->HasData(e);
 	}
 
 
-	template<typename T, unsigned N>
+	template<typename T>
 	T* ComponentManager::GetComponent(const Entity& e)
 	{
-		// Get a reference to the component
-		return GetComponentArray<T, N>()->GetData(e);
+		EntityID id = e.GetEntityID();
+		return GetComponent<T>(id);
 	}
 
 
-	template<typename T, unsigned N>
+	template<typename T>
 	T* ComponentManager::GetComponent(EntityID& e)
 	{
-		// Get a reference to the component
-		return GetComponentArray<T, N>()->GetData(e);
+		using U = std::remove_const_t<T>;
+
+		U* component = nullptr;
+		if (mStorageMode == StorageMode::Archetype)
+		{
+			component = mArchetypeStorage->GetComponent<U>(e, GetComponentType<U>());
+		}
+		else
+		{
+			// Get a reference to the component
+			component = GetArray<U>()->GetData(e);
+		}
+
+		if constexpr (!std::is_const_v<T>)
+		{
+			if (component)
+			{
+				MarkChanged<U>(e);
+			}
+		}
+		return component;
+	}
+
+
+	template<typename T>
+	Tick ComponentManager::GetVersion(EntityID e)
+	{
+		const std::size_t id = TypeID<IComponent>::Get<T>();
+		if (id >= mComponents.size())
+		{
+			return 0;
+		}
+
+		const PagedArray<Tick, ENTITY_PAGE_SIZE>& versions = mComponents[id].versions;
+		return e < versions.Size() ? versions[e] : 0;
+	}
+
+
+	template<typename T>
+	void ComponentManager::MarkChanged(EntityID e)
+	{
+		const std::size_t id = TypeID<IComponent>::Get<T>();
+		if (id >= mComponents.size())
+		{
+			return;
+		}
+
+		PagedArray<Tick, ENTITY_PAGE_SIZE>& versions = mComponents[id].versions;
+		if (e < versions.Size())
+		{
+			versions[e] = GetChangeTick();
+		}
+	}
+
+
+	template<typename... Ts>
+	bool ComponentManager::ChangedSince(EntityID e, Tick tick)
+	{
+		return ((GetVersion<std::remove_const_t<Ts>>(e) > tick) || ...);
+	}
+
+
+	template<typename T>
+	void ComponentManager::Observe(ComponentEvent event, ComponentObserver observer)
+	{
+		const std::size_t id = TypeID<IComponent>::Get<T>();
+		if (id >= mComponents.size() || !mComponents[id].isRegistered)
+		{
+			LOG_WARNING("Observing component that is not registered.");
+			return;
+		}
+
+		if (mDispatching)
+		{
+			mPendingObservers.emplace_back(PendingObserver{ id, event, std::move(observer) });
+			return;
+		}
+
+		AddObserver(id, event, std::move(observer));
+	}
+
+
+	template<typename... Ts, typename Func>
+	void ComponentManager::ForEachChunk(Func func)
+	{
+		if (mStorageMode != StorageMode::Archetype)
+		{
+			LOG_WARNING("ForEachChunk requires StorageMode::Archetype.");
+			return;
+		}
+
+		mArchetypeStorage->ForEachChunk<Ts...>({ GetComponentType<Ts>()... }, func);
 	}
 
 } // end of namespace
\ No newline at end of file
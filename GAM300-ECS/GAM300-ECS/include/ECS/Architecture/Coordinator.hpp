@@ -17,18 +17,29 @@
   Sequence of using the coordinator (Coordinator gCoordinator):
   1) Coordinator gCoordinator;	gCoordinator.Init();
   - Initialise Entity Manager, Component Manager, System Manager.
+  - Init(StorageMode::Archetype) stores components in archetype chunks instead
+  of per component pools (Default is StorageMode::Pool). Archetype storage is
+  experimental, snapshots and sorting components are not supported in it.
   - Register Component and System classes and systems within .Init().
-  - You can set a cap on the number of a particular Component.
   - Setting of System's Signature is also under .Init().
 
   2) std::shared_ptr<System> ptrPhysicsSystem = gCoordinator.GetSystem<PhysicsSystem>();
   - After registering system, you can call the Init/Update/Destroy functions of the system
+  - gCoordinator.UpdateSystems(deltaTime) updates every system, systems that do
+  not access the same components (AssignSystemAccess) run concurrently.
 
   3) gCoordinator.CreateEntity();
+  - gCoordinator.CreateChild(parent) / ToChild(parent, child) to build the
+  hierarchy, walk it with gCoordinator.GetHierarchy() (No allocations).
+  - gCoordinator.SetActive(id, false) deactivates the entity's subtree,
+  IsEffectivelyActive(id) is cached so inactive subtrees can be skipped.
   - To create an entity.
+  - gCoordinator.CreateEntities(count, T1{}, T2{}) to spawn many unnamed
+  entities with the same components at once.
   - Get the ID of the entity with .GetEntityID();
   - Get the name of the entity with .GetEntityName();
-  - Set the name of the entity with .SetEntityName(std::string __name__);
+  - Set the name of the entity with gCoordinator.SetEntityName(id, name);
+  (Renaming through Entity directly will not update the name lookup table)
 
   4) gCoordinator.AddComponent<T>(entity, ...);
   - Tag component to entity, T is Component class, ... is component constructor params
@@ -36,7 +47,39 @@
   5) gCoordinator.RemoveComponent<T>(entity);
   - Tag component to entity, T is Component class
 
-  6) gCoordinator.Destroy();
+  6) gCoordinator.Each<T1, T2>([](EntityID e, T1& t1, T2& t2) { ... });
+  - Iterate entities that have all of T1, T2 (Optionally Exclude<U...>{} first).
+  - gCoordinator.View<T1, T2>() to get the entities without a callback.
+  - gCoordinator.ParallelEach<T1, T2>(...) splits the entities into chunks
+  that are run as jobs on gCoordinator.GetJobSystem() (func must be thread safe).
+  - Each<const T1>(...) only reads T1, non-const components are marked as changed.
+  - Each<T1>(Changed<T1>{ mLastRunTick }, ...) in a system's Update skips
+  entities whose T1 was not changed since the system last ran.
+  - Queries are created on first use, systems updated as jobs must create
+  theirs on the main thread first with gCoordinator.PrepareQuery<T1, T2>().
+
+  7) gCoordinator.GetCommandBuffer().DestroyEntity(e);
+  - Record structural changes while iterating or from jobs, they are applied
+  by gCoordinator.PlaybackCommands() (Called at the end of UpdateSystems).
+
+  8) gCoordinator.DestroyEntity(e, delay);
+  - Destroy entity after delay seconds, expired entities are destroyed together
+  at the end of UpdateSystems.
+
+  9) gCoordinator.OnAdd<T>([](std::span<const EntityID> entities) { ... });
+  - Observe adds/removes/replaces (ReplaceComponent) of T, queued events are
+  delivered in batches at the end of UpdateSystems (Eg: to keep physics
+  actors or spatial indices in sync).
+
+  10) gCoordinator.SortComponentsAs<Particle, Transform>();
+  - Relocate components so iterating them follows an order (Entity ID,
+  hierarchy, another component's order), moved a bit at every UpdateSystems.
+
+  11) WorldSnapshot snapshot = gCoordinator.Snapshot();
+  - Copy the whole world (include WorldSnapshot.hpp), gCoordinator.Restore(snapshot)
+  puts it back. Take and restore snapshots outside of UpdateSystems.
+
+  12) gCoordinator.Destroy();
   - Free Coordinator's allocated memory.
 
   Many code such as Entity and EntityID can be tidied but I am too lazy to bother.
@@ -55,16 +98,28 @@
 #include "EntityManager.hpp"
 #include "ComponentManager.hpp"
 #include "SystemManager.hpp"
+#include "Query.hpp"
+#include "EntityCommandBuffer.hpp"
+#include "Hierarchy.hpp"
+#include "include/Job/JobSystem.hpp"
+
+#include <array>
+#include <queue>
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
 
 #define UNUSED(expr) (void)expr
 
 namespace Engine
 {
+	class WorldSnapshot;
+
 	class Coordinator
 	{
 	public:
 		~Coordinator();
-		void Init();
+		void Init(StorageMode mode = StorageMode::Pool);
 		void Destroy();
 
 		void RegisterComponents(); // Function is to register all components
@@ -72,27 +127,38 @@ namespace Engine
 
 		// Creates an entity and returns the ID
 		EntityID CreateEntity(std::string __name__ = "");
+		// Creates count unnamed entities with a copy of each prototype component, IDs, entity records and
+		// components are allocated in one go and systems/queries are matched once
+		template <typename... Ts>
+		std::vector<EntityID> CreateEntities(std::size_t count, const Ts&... prototypes);
 		void DuplicateEntity(Entity entity, EntityID parentID);
 
 		// Parent-Child functions
 		EntityID CreateChild(EntityID parent, const std::string& __name__ = "");
 		void ToChild(EntityID parent, EntityID child);
 		void UnChild(EntityID parent, EntityID child);
+		// Copy of the direct children (Walk GetHierarchy()'s sibling links to avoid allocating)
 		std::vector<EntityID> GetChildObjects(EntityID id);
 		Entity* GetChildObject(EntityID parent, uint32_t index = 0);
+		// Appends id and all of its descendants (Parents before children)
 		void GetAllChildren(std::vector<EntityID>& container, EntityID id);
 
-		std::map<EntityID, std::vector<EntityID>>& GetMap();
+		// Parent-child links and depth-first order of all entities
+		const Hierarchy& GetHierarchy() const;
 
 		// Resets entity's signature, remove it from component arrays and systems
 		void DestroyEntity(Entity& e);
 		void DestroyEntity(EntityID e);
+		// Destroys entities and all of their children together, each manager's containers are visited once
+		void DestroyEntities(std::span<const EntityID> entities);
+		// Destroys entity once delay seconds of UpdateSystems have passed (Cancelled if it is destroyed earlier)
 		void DestroyEntity(Entity e, float delay);
+		void DestroyEntity(EntityID e, float delay);
 
 		// Tag component to entity, update signature in EntityManager, SystemManager System's entities
-		template <typename T, unsigned N = 1, typename... argv>
+		template <typename T, typename... argv>
 		void AddComponent(Entity& e, argv... args);
-		template <typename T, unsigned N = 1, typename... argv>
+		template <typename T, typename... argv>
 		void AddComponent(EntityID e, argv... args);
 
 		// Retrieve Containers
@@ -104,10 +170,14 @@ namespace Engine
 		void AddToPrefabMap(std::string prefabName, EntityID id);
 		void RemoveFromPrefabMap(std::string prefabName, EntityID id);
 
+		// Assigns T(args...) to entity's existing component, observers of OnSet are notified
+		template <typename T, typename... argv>
+		void ReplaceComponent(EntityID e, argv... args);
+
 		// Remove tagged component from entity, update signature in EntityManager and System's entities
-		template <typename T, unsigned N = 0>
+		template <typename T>
 		void RemoveComponent(Entity& e);
-		template <typename T, unsigned N = 0>
+		template <typename T>
 		void RemoveComponent(EntityID e);
 
 		// Checks whether entity has a component
@@ -117,23 +187,119 @@ namespace Engine
 		bool HasComponent(EntityID e);
 
 		// Retrieve component from entity (For updating of component's variables)
+		// GetComponent<const T> to read it without marking it as changed
 		// T& GetComponent(EntityID e);
 		template <typename T>
 		T* GetComponent(const Entity& e);
 		template <typename T>
 		T* GetComponent(EntityID e);
 
+		// Retrieve packed array of component T (For iterating through all T components)
+		template <typename T>
+		std::shared_ptr<ComponentArray<T>> GetComponentArray();
+
+		// Relocates T's components into an order over the next UpdateSystems calls (SORT_STEPS_PER_UPDATE
+		// each), so iterating them is in that order (StorageMode::Pool only)
+		// Ascending entity ID order
+		template <typename T>
+		void CompactComponents();
+		// Hierarchy order, parents before children (Eg: Transform, see TransformSystem)
+		template <typename T>
+		void SortComponentsByHierarchy();
+		// Current order of U's components, co-iterating T and U then walks both arrays forward
+		template <typename T, typename U>
+		void SortComponentsAs();
+		// comp(EntityID a, EntityID b) order
+		template <typename T, typename Compare>
+		void SortComponents(Compare comp);
+
+		// Stream columns of Ts in archetype chunks, func(count, EntityID*, Ts*...) (StorageMode::Archetype)
+		template <typename... Ts, typename Func>
+		void ForEachChunk(Func func);
+
+		// Cached view of entities that have all of Ts and none of Us
+		template <typename... Ts>
+		ComponentView<Ts...> View();
+		template <typename... Ts, typename... Us>
+		ComponentView<Ts...> View(Exclude<Us...> exclude);
+		// Creates the cached query of View<Ts...>(exclude) up front (Also used by Each/ParallelEach)
+		// Queries used by systems updated as jobs must be prepared on the main thread (Eg: RegisterSystems)
+		template <typename... Ts>
+		void PrepareQuery();
+		template <typename... Ts, typename... Us>
+		void PrepareQuery(Exclude<Us...> exclude);
+
+		// Calls func(EntityID, Ts&...) for every entity that has all of Ts and none of Us
+		template <typename... Ts, typename Func>
+		void Each(Func func);
+		template <typename... Ts, typename... Us, typename Func>
+		void Each(Exclude<Us...> exclude, Func func);
+		// Only entities that had any of Us changed after changed.since
+		template <typename... Ts, typename... Us, typename Func>
+		void Each(Changed<Us...> changed, Func func);
+
+		// Same as Each but chunks of entities are run as jobs, returns once all are done
+		template <typename... Ts, typename Func>
+		void ParallelEach(Func func);
+		template <typename... Ts, typename... Us, typename Func>
+		void ParallelEach(Exclude<Us...> exclude, Func func);
+		template <typename... Ts, typename... Us, typename Func>
+		void ParallelEach(Changed<Us...> changed, Func func);
+
+		// Change tick of the last non-const access of entity's T component (See Changed)
+		template <typename T>
+		Tick GetComponentVersion(EntityID e);
+		// Current change tick, to be stored by non-system users of Changed (Eg: serialization)
+		Tick GetChangeTick() const;
+		// Starts a new change tick, called before each system update
+		Tick AdvanceChangeTick();
+
+		// Observers of T's component events, called with batches of entities by DispatchComponentEvents
+		template <typename T>
+		void OnAdd(ComponentObserver observer);
+		template <typename T>
+		void OnRemove(ComponentObserver observer);
+		template <typename T>
+		void OnSet(ComponentObserver observer);
+		// Delivers queued component events (Called at the end of UpdateSystems)
+		void DispatchComponentEvents();
+
+		// Worker threads shared by systems (See JobSystem)
+		JobSystem& GetJobSystem();
+
+		// Command buffer of the calling thread (Main thread or a JobSystem worker)
+		EntityCommandBuffer& GetCommandBuffer();
+		// Applies and clears the commands of all threads' buffers, no jobs may be recording
+		void PlaybackCommands();
+
 		// Retrieve pointer of system using type.
 		template <typename T>
 		std::shared_ptr<System> GetSystem();
 
+		// Calls Update(this, deltaTime) of all systems (See SystemScheduler)
+		void UpdateSystems(float deltaTime);
+
 		Entity* GetEntity(EntityID id);
-		Entity* GetEntityByName(std::string name);
+		Entity* GetEntityByName(std::string_view name);
 
-		bool IsNameRepeated(std::string name);
-		bool IsNameRepeated(Entity e);
+		// Renames entity and updates the name lookup table
+		void SetEntityName(EntityID id, std::string name);
+		// Returns prefix + n + suffix that is not used by any entity (n counts up per prefix)
+		std::string GetUniqueName(const std::string& prefix, const std::string& suffix = ")");
+
+		bool IsNameRepeated(std::string_view name);
+		bool IsNameRepeated(const Entity& e);
 		bool EntityExists(EntityID id);
 
+		// Generational handle of entity, to be checked with IsAlive before using a stored ID
+		EntityHandle GetHandle(EntityID id);
+		bool IsAlive(EntityHandle handle);
+
+		// Sets entity's own active flag, its subtree's effective active state is updated
+		void SetActive(EntityID id, bool active);
+		// Whether entity and all of its ancestors are active (Single bit test, false for IDs never created)
+		bool IsEffectivelyActive(EntityID id) const;
+		// Same as IsEffectivelyActive
 		bool CheckParentIsActive(Entity& e);
 		bool CheckParentIsActive(EntityID id);
 
@@ -142,12 +308,25 @@ namespace Engine
 		Tag GetTag(Entity& e);
 		Tag GetTag(EntityID e);
 
+		// Frees component pages left empty by removed components (Eg: after unloading a scene)
+		// Returns number of pages freed
+		std::size_t ReleaseEmptyComponentPages();
+
+		// Copies the whole world into snapshot, reusing its memory (StorageMode::Pool only)
+		// Commands recorded but not played back yet are not part of it, fails if a component is not copyable
+		bool Snapshot(WorldSnapshot& snapshot);
+		WorldSnapshot Snapshot();
+		// Replaces the whole world with snapshot's, recorded commands and queued component events
+		// are dropped, restored components are marked as changed (World is unchanged if it fails)
+		bool Restore(const WorldSnapshot& snapshot);
+
 	private:
 		/* Member Functions */
 
-		// Register component as a component array
-		template <typename T, unsigned N>
-		void RegisterComponent();
+		// Register component as a component array (Grows by pages as components are added)
+		// capacityHint - Number of components to allocate up front (Eg: components almost every entity has)
+		template <typename T>
+		void RegisterComponent(std::size_t capacityHint = 0);
 
 		// Retrieve component's type (To create signature for system)
 		template <typename T>
@@ -173,102 +352,232 @@ namespace Engine
 		template <typename T>
 		void SetSystemSignature(Signature signature);
 
+		// Declare components system T reads/writes in Update, mainThread for systems that must not run on workers
+		template <typename T, typename... Rs, typename... Ws>
+		void AssignSystemAccess(Read<Rs...> reads, Write<Ws...> writes, bool mainThread = false);
+
+		// Add/remove entity from mEntities and keep mEntityIndex in sync (swap-and-pop)
+		void AddEntity(const Entity& e);
+		void RemoveEntity(EntityID e);
+
+		// Recomputes the effective active state of entity's subtree (Parents before children)
+		void RefreshActive(EntityID e);
+
+		// Advances time and records destroys of expired timed destroys into the main thread's command buffer
+		void ProcessTimedDestroys(float deltaTime);
+
+		// Retrieve cached query, creates and fills it from the smallest pool of Ts on first use (Main thread only)
+		template <typename... Ts, typename... Us>
+		Query& GetQuery(Exclude<Us...> exclude);
+
 		/* Data Members */
 		Allocator* mFreeListAllocator = nullptr;
 
 		std::unique_ptr<EntityManager> mEntityManager;
 		std::unique_ptr<ComponentManager> mComponentManager;
 		std::unique_ptr<SystemManager> mSystemManager;
+		std::unique_ptr<QueryManager> mQueryManager;
+		std::unique_ptr<JobSystem> mJobSystem;
+
+		// Index corresponds to JobSystem::GetThreadIndex()
+		std::vector<EntityCommandBuffer> mCommandBuffers{};
 
 		std::vector<Entity> mEntities{};
-		std::map<EntityID, std::vector<EntityID>> mParentChild{};
+
+		// Index corresponds to EntityID, value is the entity's index in mEntities
+		static constexpr std::uint32_t INVALID_INDEX = (std::numeric_limits<std::uint32_t>::max)();
+		PagedArray<std::uint32_t, ENTITY_PAGE_SIZE> mEntityIndex{ INVALID_INDEX };
+
+		// Entity name (See Entity::GetEntityNameKey) to ID, and next suffix number to try for each name prefix
+		std::unordered_map<std::uint64_t, EntityID> mEntityNames{};
+		std::unordered_map<std::string, int> mNameSuffixes{};
+		Hierarchy mHierarchy{};
+
+		// Bit e % 64 of word e / 64 is set if entity e is effectively active (See IsEffectivelyActive)
+		PagedArray<std::uint64_t, ENTITY_PAGE_SIZE / 64> mEffectiveActive{ 0 };
 		std::unordered_map<std::string, std::vector<EntityID>> mPrefabReloading{};
 
-		// Timed Destroy (Scripts)
-		std::vector<std::pair<unsigned int, float>> v_timed_destroys;
+		// Timed Destroy (Scripts), min-heap on time of destruction
+		struct TimedDestroy
+		{
+			double time;
+			EntityHandle handle;
+
+			bool operator>(const TimedDestroy& rhs) const { return time > rhs.time; }
+		};
+		using TimedDestroyQueue = std::priority_queue<TimedDestroy, std::vector<TimedDestroy>, std::greater<TimedDestroy>>;
+		TimedDestroyQueue mTimedDestroys{};
+
+		// Seconds passed through UpdateSystems
+		double mTime = 0.0;
+
+		// Components placed per array being sorted at every UpdateSystems
+		static constexpr std::size_t SORT_STEPS_PER_UPDATE = 4096;
+
+		friend class WorldSnapshot;
 	};
 
 	// Templated class functions implementations
 
-	template <typename T, unsigned N, typename... argv>
+	template <typename... Ts>
+	std::vector<EntityID> Coordinator::CreateEntities(std::size_t count, const Ts&... prototypes)
+	{
+		Signature signature{};
+		(signature.set(GetComponentType<Ts>()), ...);
+
+		std::vector<EntityID> ids = mEntityManager->CreateEntities(count, signature);
+		if (ids.empty())
+		{
+			return ids;
+		}
+
+		// Entity table, hierarchy and active states in one pass (Unnamed, so not in the name lookup)
+		const EntityID last = *std::max_element(ids.begin(), ids.end());
+		mEntityIndex.Resize(static_cast<std::size_t>(last) + 1);
+		mEffectiveActive.Resize(static_cast<std::size_t>(last) / 64 + 1);
+		mEntities.reserve(mEntities.size() + count);
+		for (EntityID e : ids)
+		{
+			mEntityIndex[e] = static_cast<std::uint32_t>(mEntities.size());
+			mEntities.emplace_back(Entity{ e });
+
+			// Active root entities without children
+			mEffectiveActive[e / 64] |= std::uint64_t{ 1 } << (e % 64);
+		}
+		mHierarchy.Add(ids);
+
+		// Each prototype is appended to its pool as one block
+		const std::array<std::size_t, sizeof...(Ts)> added{ mComponentManager->AddComponents<Ts>(ids, prototypes)... };
+		const std::array<ComponentType, sizeof...(Ts)> types{ GetComponentType<Ts>()... };
+		const std::size_t complete = added.empty() ? count : *std::min_element(added.begin(), added.end());
+
+		// Storage ran out for some components of the entities after complete
+		for (std::size_t i = complete; i < count; ++i)
+		{
+			Signature partial{};
+			for (std::size_t t = 0; t < types.size(); ++t)
+			{
+				if (i < added[t])
+				{
+					partial.set(types[t]);
+				}
+			}
+
+			mEntityManager->SetSignature(ids[i], partial);
+			if (partial.any())
+			{
+				mSystemManager->EntitySignatureChanged(ids[i], partial, partial);
+				mQueryManager->EntitySignatureChanged(ids[i], partial);
+			}
+		}
+
+		if (signature.any())
+		{
+			std::span<const EntityID> matched = std::span<const EntityID>(ids).first(complete);
+			mSystemManager->EntitiesCreated(matched, signature);
+			mQueryManager->EntitiesCreated(matched, signature);
+		}
+
+		return ids;
+	}
+
+
+	template <typename T, typename... argv>
 	void Coordinator::AddComponent(Entity& e, argv... args)
 	{
-		bool flag = mComponentManager->AddComponent<T, N>(e, args...);
+		bool flag = mComponentManager->AddComponent<T>(e, args...);
 		if (flag == false)
 		{
 			return;
 		}
 
 		// Update Entity's signature
+		const ComponentType type = mComponentManager->GetComponentType<T>();
 		auto signature = mEntityManager->GetSignature(e);
-		signature.set(mComponentManager->GetComponentType<T>(), true);
+		signature.set(type, true);
 		mEntityManager->SetSignature(e, signature);
 
-		// Update System's entity container
-		mSystemManager->EntitySignatureChanged(e, signature);
+		// Update System's entity container and cached queries
+		mSystemManager->EntitySignatureChanged(e.GetEntityID(), signature, type);
+		mQueryManager->EntitySignatureChanged(e.GetEntityID(), signature);
 	}
 
 
-	template <typename T, unsigned N, typename... argv>
+	template <typename T, typename... argv>
 	void Coordinator::AddComponent(EntityID e, argv... args)
 	{
-		bool flag = mComponentManager->AddComponent<T, N>(e, args...);
+		bool flag = mComponentManager->AddComponent<T>(e, args...);
 		if (flag == false)
 		{
 			return;
 		}
 
 		// Update Entity's signature
+		const ComponentType type = mComponentManager->GetComponentType<T>();
 		auto signature = mEntityManager->GetSignature(e);
-		signature.set(mComponentManager->GetComponentType<T>(), true);
+		signature.set(type, true);
 		mEntityManager->SetSignature(e, signature);
 
-		// Update System's entity container
-		mSystemManager->EntitySignatureChanged(e, signature);
+		// Update System's entity container and cached queries
+		mSystemManager->EntitySignatureChanged(e, signature, type);
+		mQueryManager->EntitySignatureChanged(e, signature);
+	}
+
+
+	template <typename T, typename... argv>
+	void Coordinator::ReplaceComponent(EntityID e, argv... args)
+	{
+		mComponentManager->ReplaceComponent<T>(e, args...);
 	}
 
 
-	template <typename T, unsigned N>
+	template <typename T>
 	void Coordinator::RemoveComponent(Entity& e)
 	{
-		mComponentManager->RemoveComponent<T, N>(e);
+		mComponentManager->RemoveComponent<T>(e);
 
 		// Update Entity's signature
+		const ComponentType type = mComponentManager->GetComponentType<T>();
 		auto signature = mEntityManager->GetSignature(e);
-		signature.set(mComponentManager->GetComponentType<T>(), false);
+		signature.set(type, false);
 		mEntityManager->SetSignature(e, signature);
 
-		// Update System's entity container
-		mSystemManager->EntitySignatureChanged(e, signature);
+		// Update System's entity container and cached queries
+		mSystemManager->EntitySignatureChanged(e.GetEntityID(), signature, type);
+		mQueryManager->EntitySignatureChanged(e.GetEntityID(), signature);
 	}
 
 
-	template <typename T, unsigned N>
+	template <typename T>
 	void Coordinator::RemoveComponent(EntityID e)
 	{
-		mComponentManager->RemoveComponent<T, N>(e);
+		mComponentManager->RemoveComponent<T>(e);
 
 		// Update Entity's signature
+		const ComponentType type = mComponentManager->GetComponentType<T>();
 		auto signature = mEntityManager->GetSignature(e);
-		signature.set(mComponentManager->GetComponentType<T>(), false);
+		signature.set(type, false);
 		mEntityManager->SetSignature(e, signature);
 
-		// Update System's entity container
-		mSystemManager->EntitySignatureChanged(e, signature);
+		// Update System's entity container and cached queries
+		mSystemManager->EntitySignatureChanged(e, signature, type);
+		mQueryManager->EntitySignatureChanged(e, signature);
 	}
 
 
 	template <typename T>
 	bool Coordinator::HasComponent(Entity& e)
 	{
-		return mComponentManager->HasComponent<T>(e);
+		return HasComponent<T>(e.GetEntityID());
 	}
 
 
 	template <typename T>
 	bool Coordinator::HasComponent(EntityID e)
 	{
-		return mComponentManager->HasComponent<T>(e);
+		// Entity's signature is always in sync with the components it has
+		ComponentType type{};
+		return mComponentManager->FindComponentType<T>(type) && mEntityManager->HasComponent(e, type);
 	}
 
 
@@ -286,6 +595,237 @@ namespace Engine
 	}
 
 
+	template<typename T>
+	std::shared_ptr<ComponentArray<T>> Coordinator::GetComponentArray()
+	{
+		return mComponentManager->GetComponentArray<T>();
+	}
+
+
+	template <typename T>
+	void Coordinator::CompactComponents()
+	{
+		mComponentManager->Compact<T>();
+	}
+
+
+	template <typename T>
+	void Coordinator::SortComponentsByHierarchy()
+	{
+		mComponentManager->SortAs<T>(mHierarchy.GetOrder());
+	}
+
+
+	template <typename T, typename U>
+	void Coordinator::SortComponentsAs()
+	{
+		mComponentManager->SortAs<T, U>();
+	}
+
+
+	template <typename T, typename Compare>
+	void Coordinator::SortComponents(Compare comp)
+	{
+		mComponentManager->Sort<T>(comp);
+	}
+
+
+	template <typename... Ts, typename Func>
+	void Coordinator::ForEachChunk(Func func)
+	{
+		mComponentManager->ForEachChunk<Ts...>(func);
+	}
+
+
+	template <typename... Ts>
+	ComponentView<Ts...> Coordinator::View()
+	{
+		return View<Ts...>(Exclude<>{});
+	}
+
+
+	template <typename... Ts, typename... Us>
+	ComponentView<Ts...> Coordinator::View(Exclude<Us...> exclude)
+	{
+		return ComponentView<Ts...>(GetQuery<Ts...>(exclude).GetEntities(), *mComponentManager);
+	}
+
+
+	template <typename... Ts>
+	void Coordinator::PrepareQuery()
+	{
+		PrepareQuery<Ts...>(Exclude<>{});
+	}
+
+
+	template <typename... Ts, typename... Us>
+	void Coordinator::PrepareQuery(Exclude<Us...> exclude)
+	{
+		GetQuery<Ts...>(exclude);
+	}
+
+
+	template <typename... Ts, typename Func>
+	void Coordinator::Each(Func func)
+	{
+		if constexpr (sizeof...(Ts) == 1)
+		{
+			using T = std::tuple_element_t<0, std::tuple<Ts...>>;
+			using U = std::remove_const_t<T>;
+
+			// Single component, stream the packed array directly (No lookups)
+			if (mComponentManager->GetStorageMode() == StorageMode::Pool)
+			{
+				auto array = GetComponentArray<U>();
+				std::span<const EntityID> entities = array->GetEntities();
+
+				for (std::size_t page = 0, first = 0; page < array->GetPageCount(); ++page)
+				{
+					auto components = array->GetPage(page);
+					for (std::size_t i = 0; i < components.size(); ++i)
+					{
+						if constexpr (!std::is_const_v<T>)
+						{
+							mComponentManager->MarkChanged<U>(entities[first + i]);
+						}
+						func(entities[first + i], static_cast<T&>(components[i]));
+					}
+					first += components.size();
+				}
+				return;
+			}
+		}
+
+		Each<Ts...>(Exclude<>{}, func);
+	}
+
+
+	template <typename... Ts, typename... Us, typename Func>
+	void Coordinator::Each(Exclude<Us...> exclude, Func func)
+	{
+		View<Ts...>(exclude).Each(func);
+	}
+
+
+	template <typename... Ts, typename... Us, typename Func>
+	void Coordinator::Each(Changed<Us...> changed, Func func)
+	{
+		ComponentView<Ts...> view = View<Ts...>();
+
+		for (EntityID e : view)
+		{
+			// Checked before Get, which marks non-const components as changed
+			if (mComponentManager->ChangedSince<Us...>(e, changed.since))
+			{
+				func(e, view.template Get<Ts>(e)...);
+			}
+		}
+	}
+
+
+	template <typename... Ts, typename Func>
+	void Coordinator::ParallelEach(Func func)
+	{
+		if constexpr (sizeof...(Ts) == 1)
+		{
+			using T = std::tuple_element_t<0, std::tuple<Ts...>>;
+			using U = std::remove_const_t<T>;
+
+			// Single component, a page of the packed array per job (Pages are cache-sized)
+			if (mComponentManager->GetStorageMode() == StorageMode::Pool)
+			{
+				auto array = GetComponentArray<U>();
+				std::span<const EntityID> entities = array->GetEntities();
+				constexpr std::size_t perPage = ComponentArray<U>::COMPONENTS_PER_PAGE;
+
+				mJobSystem->ParallelFor(array->GetPageCount(), 1, [&](std::size_t begin, std::size_t end)
+				{
+					for (std::size_t page = begin; page < end; ++page)
+					{
+						auto components = array->GetPage(page);
+						for (std::size_t i = 0; i < components.size(); ++i)
+						{
+							if constexpr (!std::is_const_v<T>)
+							{
+								mComponentManager->MarkChanged<U>(entities[page * perPage + i]);
+							}
+							func(entities[page * perPage + i], static_cast<T&>(components[i]));
+						}
+					}
+				});
+				return;
+			}
+		}
+
+		ParallelEach<Ts...>(Exclude<>{}, func);
+	}
+
+
+	template <typename... Ts, typename... Us, typename Func>
+	void Coordinator::ParallelEach(Exclude<Us...> exclude, Func func)
+	{
+		ComponentView<Ts...> view = View<Ts...>(exclude);
+		const EntityID* entities = view.begin();
+		constexpr std::size_t grain = JobSystem::GrainSize<std::tuple<Ts...>>();
+
+		mJobSystem->ParallelFor(view.Size(), grain, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				func(entities[i], view.template Get<Ts>(entities[i])...);
+			}
+		});
+	}
+
+
+	template <typename... Ts, typename... Us, typename Func>
+	void Coordinator::ParallelEach(Changed<Us...> changed, Func func)
+	{
+		ComponentView<Ts...> view = View<Ts...>();
+		const EntityID* entities = view.begin();
+		constexpr std::size_t grain = JobSystem::GrainSize<std::tuple<Ts...>>();
+
+		mJobSystem->ParallelFor(view.Size(), grain, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				if (mComponentManager->ChangedSince<Us...>(entities[i], changed.since))
+				{
+					func(entities[i], view.template Get<Ts>(entities[i])...);
+				}
+			}
+		});
+	}
+
+
+	template <typename T>
+	void Coordinator::OnAdd(ComponentObserver observer)
+	{
+		mComponentManager->Observe<T>(ComponentEvent::Add, std::move(observer));
+	}
+
+
+	template <typename T>
+	void Coordinator::OnRemove(ComponentObserver observer)
+	{
+		mComponentManager->Observe<T>(ComponentEvent::Remove, std::move(observer));
+	}
+
+
+	template <typename T>
+	void Coordinator::OnSet(ComponentObserver observer)
+	{
+		mComponentManager->Observe<T>(ComponentEvent::Set, std::move(observer));
+	}
+
+
+	template <typename T>
+	Tick Coordinator::GetComponentVersion(EntityID e)
+	{
+		return mComponentManager->GetVersion<T>(e);
+	}
+
+
 	template <typename T>
 	std::shared_ptr<System> Coordinator::GetSystem()
 	{
@@ -293,10 +833,10 @@ namespace Engine
 	}
 
 
-	template <typename T, unsigned N>
-	void Coordinator::RegisterComponent()
+	template <typename T>
+	void Coordinator::RegisterComponent(std::size_t capacityHint)
 	{
-		mComponentManager->RegisterComponent<T, N>(mFreeListAllocator);
+		mComponentManager->RegisterComponent<T>(mFreeListAllocator, capacityHint);
 	}
 
 
@@ -349,4 +889,70 @@ namespace Engine
 		mSystemManager->SetSignature<T>(signature);
 	}
 
+
+	template <typename T, typename... Rs, typename... Ws>
+	void Coordinator::AssignSystemAccess(Read<Rs...> reads, Write<Ws...> writes, bool mainThread)
+	{
+		UNUSED(reads);
+		UNUSED(writes);
+
+		SystemAccess access{};
+		(access.reads.set(GetComponentType<Rs>()), ...);
+		(access.writes.set(GetComponentType<Ws>()), ...);
+		access.mainThread = mainThread;
+		mSystemManager->SetAccess<T>(access);
+	}
+
+
+	template <typename... Ts, typename... Us>
+	Query& Coordinator::GetQuery(Exclude<Us...> exclude)
+	{
+		UNUSED(exclude);
+
+		// const does not change which entities match
+		using Key = QueryKey<std::tuple<std::remove_const_t<Ts>...>, std::tuple<Us...>>;
+		if (Query* query = mQueryManager->GetQuery<Key>())
+		{
+			return *query;
+		}
+
+		// Creating resizes the query containers, which jobs may be reading
+		LOG_ASSERT(mJobSystem->GetThreadIndex() == 0 && "Query created off the main thread, see PrepareQuery.");
+
+		Signature include{}, excluded{};
+		(include.set(GetComponentType<std::remove_const_t<Ts>>()), ...);
+		(excluded.set(GetComponentType<Us>()), ...);
+		Query& query = mQueryManager->CreateQuery<Key>(include, excluded);
+
+		if (mComponentManager->GetStorageMode() == StorageMode::Pool)
+		{
+			// Only entities in the smallest pool can match, signatures filter the rest
+			std::span<const EntityID> smallest{};
+			bool first = true;
+			auto FindSmallest = [&](std::span<const EntityID> entities)
+			{
+				if (first || entities.size() < smallest.size())
+				{
+					smallest = entities;
+					first = false;
+				}
+			};
+			(FindSmallest(GetComponentArray<std::remove_const_t<Ts>>()->GetEntities()), ...);
+
+			for (EntityID e : smallest)
+			{
+				query.EntitySignatureChanged(e, mEntityManager->GetSignature(e));
+			}
+		}
+		else
+		{
+			for (Entity& e : mEntities)
+			{
+				query.EntitySignatureChanged(e.GetEntityID(), mEntityManager->GetSignature(e));
+			}
+		}
+
+		return query;
+	}
+
 } // end of namespace
\ No newline at end of file
@@ -8,10 +8,12 @@
 \brief
   This file contains the definition of variables: 
   - EntityID
-  - MAX_ENTITIES (Maximum amount of entities)
+  - MAX_ENTITIES (Maximum amount of entities, storage grows as needed)
+  - INVALID_ENTITY
+  - EntityHandle (EntityID + generation, to detect IDs of destroyed entities)
   - ComponentType
   - MAX_COMPONENTS (Maximum amount of component types)
-  - Signature (Use for tracking in systems. Bitset.)
+  - Signature (Use for tracking in systems. Bitset of ECS_SIGNATURE_BITS, 64/128/256.)
   
   - Layer, MAX_LAYERS, Tag 
   (A mock of unity's physics tag and layer, catered to what is needed ONLY)
@@ -24,17 +26,56 @@
 /******************************************************************************/
 #pragma once
 
+#include "Signature.hpp"
+
 #include <cstdint>
 #include <bitset>
 
+// Number of component types a signature can hold (64, 128 or 256), define before including to change.
+#ifndef ECS_SIGNATURE_BITS
+#define ECS_SIGNATURE_BITS 64
+#endif
+
 namespace Engine
 {
 	using EntityID = std::uint32_t;
-	const EntityID MAX_ENTITIES = 5000;
 
-	using ComponentType = std::uint8_t;
-	const ComponentType MAX_COMPONENTS = 32;
-	using Signature = std::bitset<MAX_COMPONENTS>;
+	// | generation (12 bits) | entity ID (20 bits) |
+	// Generation of an ID is increased every time the entity using it is destroyed.
+	// IDs are retired after their last generation (See EntityManager).
+	using EntityHandle = std::uint32_t;
+	const std::uint32_t HANDLE_ENTITY_BITS = 20;
+	const std::uint32_t HANDLE_ENTITY_MASK = (1u << HANDLE_ENTITY_BITS) - 1;
+	const std::uint32_t HANDLE_GENERATION_MASK = (1u << (32 - HANDLE_ENTITY_BITS)) - 1;
+
+	// Storage indexed by entity ID grows by pages of ENTITY_PAGE_SIZE, up to MAX_ENTITIES
+	const EntityID MAX_ENTITIES = 1u << HANDLE_ENTITY_BITS;
+	const EntityID ENTITY_PAGE_SIZE = 4096;
+
+	// No entity (e.g. parent of a root entity)
+	const EntityID INVALID_ENTITY = 0xFFFFFFFF;
+
+	inline EntityHandle MakeHandle(EntityID e, std::uint32_t generation)
+	{
+		return ((generation & HANDLE_GENERATION_MASK) << HANDLE_ENTITY_BITS) | (e & HANDLE_ENTITY_MASK);
+	}
+
+	inline EntityID GetHandleEntity(EntityHandle h)
+	{
+		return h & HANDLE_ENTITY_MASK;
+	}
+
+	inline std::uint32_t GetHandleGeneration(EntityHandle h)
+	{
+		return h >> HANDLE_ENTITY_BITS;
+	}
+
+	using ComponentType = std::uint16_t;
+	const ComponentType MAX_COMPONENTS = ECS_SIGNATURE_BITS;
+	using Signature = BitSignature<MAX_COMPONENTS>;
+
+	// Incremented before every system update, components are stamped with it on non-const access
+	using Tick = std::uint32_t;
 
 	using Layer = std::uint8_t;
 	const Layer MAX_LAYERS = 32;
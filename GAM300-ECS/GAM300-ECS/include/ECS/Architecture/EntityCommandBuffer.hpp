@@ -0,0 +1,167 @@
+/******************************************************************************/
+/*!
+\file       EntityCommandBuffer.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration and implementation of EntityCommandBuffer
+  class.
+
+  EntityCommandBuffer records structural changes (Create/Destroy entity,
+  Add/Remove component) instead of applying them, so they can be made while
+  iterating entities or from jobs. Recorded commands are applied by
+  Coordinator::PlaybackCommands at a sync point (End of UpdateSystems):
+  - Entities are created first, in the order they were recorded.
+  - Component changes are sorted by entity, and each entity's signature is
+  only matched against systems/queries once for all of its changes.
+  - Destroyed entities are destroyed last, their component changes are skipped.
+
+  A buffer is not thread safe, use Coordinator::GetCommandBuffer to get the
+  buffer of the calling thread (No locks needed).
+
+  CreateEntity returns a deferred ID, which can only be used with the same
+  buffer until playback (It is not a valid EntityID). Commands of another
+  buffer using it are skipped by playback.
+
+  Components to be added are stored in blocks of memory owned by the buffer,
+  which are kept for reuse after playback.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include "ECS.hpp"
+#include "ComponentManager.hpp"
+
+#include <new>
+#include <span>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+namespace Engine
+{
+	class EntityCommandBuffer
+	{
+	public:
+		enum class CommandType : std::uint8_t
+		{
+			CreateEntity,
+			DestroyEntity,
+			AddComponent,
+			RemoveComponent
+		};
+
+		// Type-erased functions of component type T
+		struct ComponentOps
+		{
+			ComponentType (*getType)(ComponentManager& manager);
+			bool (*add)(ComponentManager& manager, EntityID e, void* component);
+			void (*remove)(ComponentManager& manager, EntityID e);
+			void (*destroy)(void* component);
+		};
+
+		struct Command
+		{
+			CommandType type = CommandType::CreateEntity;
+			EntityID entity = INVALID_ENTITY;
+
+			// AddComponent/RemoveComponent
+			const ComponentOps* ops = nullptr;
+			// AddComponent, component constructed in the buffer's memory
+			void* component = nullptr;
+		};
+
+		// Deferred IDs have this bit set, lower bits are the index of the created entity
+		static constexpr EntityID DEFERRED_ENTITY_BIT = 0x80000000;
+
+		EntityCommandBuffer() = default;
+		~EntityCommandBuffer();
+
+		EntityCommandBuffer(EntityCommandBuffer&&) = default;
+		EntityCommandBuffer& operator=(EntityCommandBuffer&&) = delete;
+
+		// Returns deferred ID of the entity to be created
+		EntityID CreateEntity(std::string name = "");
+		void DestroyEntity(EntityID e);
+
+		template <typename T, typename... argv>
+		void AddComponent(EntityID e, argv... args);
+		template <typename T>
+		void RemoveComponent(EntityID e);
+
+		std::span<const Command> GetCommands() const;
+		// Name of the index-th created entity
+		const std::string& GetCreatedName(std::size_t index) const;
+
+		bool Empty() const;
+
+		// Destroys unapplied components and removes all commands
+		void Clear();
+
+		static bool IsDeferred(EntityID e);
+
+	private:
+		struct Block
+		{
+			std::unique_ptr<std::byte[]> data{};
+			std::size_t size = 0;
+			std::size_t used = 0;
+		};
+
+		// Minimum bytes per block of component memory
+		static constexpr std::size_t BLOCK_SIZE = 64 * 1024;
+
+		void* Allocate(std::size_t size, std::size_t alignment);
+
+		template <typename T>
+		static const ComponentOps* GetOps();
+
+		std::vector<Command> mCommands{};
+		std::vector<std::string> mCreatedNames{};
+
+		std::vector<Block> mBlocks{};
+		std::size_t mCurrentBlock = 0;
+	};
+
+
+	// Templated class functions implementations
+
+	template <typename T, typename... argv>
+	void EntityCommandBuffer::AddComponent(EntityID e, argv... args)
+	{
+		void* memory = Allocate(sizeof(T), alignof(T));
+		T* component = new (memory) T(args...);
+
+		mCommands.emplace_back(Command{ CommandType::AddComponent, e, GetOps<T>(), component });
+	}
+
+
+	template <typename T>
+	void EntityCommandBuffer::RemoveComponent(EntityID e)
+	{
+		mCommands.emplace_back(Command{ CommandType::RemoveComponent, e, GetOps<T>(), nullptr });
+	}
+
+
+	template <typename T>
+	const EntityCommandBuffer::ComponentOps* EntityCommandBuffer::GetOps()
+	{
+		static constexpr ComponentOps ops
+		{
+			[](ComponentManager& manager) { return manager.GetComponentType<T>(); },
+			[](ComponentManager& manager, EntityID e, void* component) { return manager.AddComponent<T>(e, std::move(*static_cast<T*>(component))); },
+			[](ComponentManager& manager, EntityID e) { manager.RemoveComponent<T>(e); },
+			[](void* component) { static_cast<T*>(component)->~T(); }
+		};
+		return &ops;
+	}
+
+} // end of namespace
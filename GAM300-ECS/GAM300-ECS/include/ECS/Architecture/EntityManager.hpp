@@ -11,9 +11,27 @@
   The Entity Manager is in charge of distributing entity IDs and keeping record 
   of which IDs are in use and which are not.
 
-  A queue is used where it will contain every valid entity ID up to MAX_ENTITIES.
-  When an entity is created, it takes the ID at the front of the queue. 
-  When an entity is destroyed, it puts the ID at the back of the queue.
+  Every entity ID has a record (signature, generation and free list link).
+  When an entity is destroyed, its ID is pushed to the front of a free list
+  that is stored within the records themselves (No extra container).
+  When an entity is created, it takes the most recently freed ID (LIFO), else
+  the lowest ID that has never been used. This keeps IDs in use packed at the
+  low end, which is better for containers indexed by entity ID.
+
+  Records and tags are stored in pages that are allocated as new IDs are
+  handed out, so memory grows with the number of entities up to MAX_ENTITIES.
+
+  The generation of an ID is increased when its entity is destroyed, so an
+  EntityHandle taken before that can be detected as stale with IsAlive. An ID
+  whose generation would wrap around (HANDLE_GENERATION_MASK) is retired
+  instead of reused, so a stale handle never matches a later entity.
+
+  Entity only holds the entity's hot data (IDs and flags), its name, prefab
+  and tag are interned in StringTable and stored as StringIDs. Use the
+  string_view/StringID getters to read or compare them without allocating.
+  Names ending with a number in brackets ("Name (2)", "Name(2)") are stored
+  as their base ("Name (") and number, so unique names generated for
+  duplicates are not interned one by one.
 
   Copyright (C) 2022 DigiPen Institure of Technology.
   Reproduction or disclosure of this file or its contents
@@ -24,8 +42,13 @@
 #pragma once
 	
 #include "ECS.hpp"
-#include <queue>
-#include <array>
+#include "PagedArray.hpp"
+#include "StringTable.hpp"
+
+#include <limits>
+#include <vector>
+#include <string_view>
+#include <type_traits>
 #include "rttr/type.h"
 #include "rttr/registration.h"
 
@@ -36,14 +59,25 @@ namespace Engine
 	class Entity
 	{
 	public:
-		Entity(EntityID __id__ = MAX_ENTITIES + 1, std::string __name__ = "");
+		Entity(EntityID __id__ = INVALID_ENTITY, std::string __name__ = "");
 		Entity(EntityID __id__, EntityID __parent__, std::string __name__ = "");
 
 		// Getter, Setter
 		EntityID GetEntityID() const;
 
+		// Use Coordinator::SetEntityName for entities in the coordinator (Keeps name lookup in sync)
 		void SetEntityName(std::string __name__);
 		std::string GetEntityName() const;
+		// Base of the name, without its number (See GetEntityNameNumber)
+		std::string_view GetEntityNameView() const;
+		StringID GetEntityNameID() const;
+		// 0 if the name does not end with a number in brackets
+		std::uint32_t GetEntityNameNumber() const;
+
+		// Whole name (Base and number) as one key, for name lookups
+		std::uint64_t GetEntityNameKey() const;
+		// Key of name, never matches an entity if its base was not interned (Nothing is added)
+		static std::uint64_t FindNameKey(std::string_view name);
 
 		// For duplication
 		void Copy(const Entity& rhs);
@@ -53,38 +87,49 @@ namespace Engine
 		void SetIs_Child(bool);
 		void SetIs_Parent(bool);
 		void SetParentID(EntityID);
+		// Use Coordinator::SetActive for entities in the coordinator (Keeps children's active state in sync)
 		void SetIs_Active(bool);
 		bool GetIsActive();
 		EntityID GetParent() const;
 
 		void SetPrefab(std::string __prefab__);
 		std::string GetPrefab() const;
+		std::string_view GetPrefabView() const;
+		StringID GetPrefabID() const;
 
 		void SetKeyTag(std::string __tag__);
 		std::string GetKeyTag() const;
+		std::string_view GetKeyTagView() const;
+		StringID GetKeyTagID() const;
 
-		RTTR_ENABLE()
 	private:
 		EntityID id;
-		std::string name;
-		std::string prefab{};
+		EntityID parent; // parent id given that is_child is true
 
-		std::string tag{};
+		// Interned in StringTable (std::string getters are for serialization)
+		StringID name = StringTable::EMPTY_STRING;
+		std::uint32_t nameNumber = 0;
+		StringID prefab = StringTable::EMPTY_STRING;
+		StringID tag = StringTable::EMPTY_STRING;
 
-		EntityID parent; // parent id given that is_child is true
 		bool is_child;
 		bool is_parent;
 		bool isActive;
 	};
 
+	// Entities are copied by value (Coordinator::GetEntities, DuplicateEntity), which must not allocate
+	static_assert(std::is_trivially_copyable_v<Entity>, "Entity must be trivially copyable.");
+
 
 	class EntityManager
 	{
 	public:
 		EntityManager();
 
-		Entity CreateEntity(std::string __name__ = "", EntityID _parent = MAX_ENTITIES + 1);
+		Entity CreateEntity(std::string __name__ = "", EntityID _parent = INVALID_ENTITY);
 		Entity CreateChild(EntityID _parent, const std::string& __name__ = "");
+		// Takes count IDs at once (Freed IDs first) and sets their signature, entities are unnamed
+		std::vector<EntityID> CreateEntities(std::size_t count, Signature signature);
 
 		void DestroyEntity(Entity& e);
 		void DestroyEntity(EntityID& e);
@@ -94,18 +139,39 @@ namespace Engine
 		Signature GetSignature(Entity& e);
 		Signature GetSignature(EntityID& e);
 
+		// Bit test on entity's signature
+		bool HasComponent(EntityID e, ComponentType type) const;
+
+		// Handle of a living entity (ID + current generation)
+		EntityHandle GetHandle(EntityID e) const;
+		// Whether handle's entity is still alive (Not destroyed since handle was taken)
+		bool IsAlive(EntityHandle h) const;
+		// Whether entity ID is currently used by an entity
+		bool IsInUse(EntityID e) const;
+
 		void SetTag(EntityID e, Tag t);
 		Tag GetTag(EntityID e);
 
 	private:
-		// Container of unused entity IDs
-		std::queue<EntityID> AvailableEntities{};
+		static constexpr EntityID END_OF_FREE_LIST = (std::numeric_limits<EntityID>::max)();
+
+		struct EntityRecord
+		{
+			Signature signature{};
+			std::uint32_t generation = 0;
+			EntityID nextFree = END_OF_FREE_LIST; // Next unused ID, only valid when not alive
+			bool alive = false;
+		};
+
+		// Container of records where index corresponds to entity ID (Grows by pages)
+		PagedArray<EntityRecord, ENTITY_PAGE_SIZE> EntitiesRecords{};
 
-		// Container of signatures where index corresponds to entity ID
-		std::array<Signature, MAX_ENTITIES> EntitiesSignatures{};
+		// Most recently freed ID, and lowest ID that has never been used
+		EntityID FreeListHead = END_OF_FREE_LIST;
+		EntityID NextUnusedEntity = 0;
 
 		// Container of Entity's tag where index corresponds to entity ID
-		std::array<Tag, MAX_ENTITIES> EntitiesTags{};
+		PagedArray<Tag, ENTITY_PAGE_SIZE> EntitiesTags{};
 
 		// Total number of active entities - used to keep limits on how many exist
 		unsigned int EntityCount;
@@ -0,0 +1,157 @@
+/******************************************************************************/
+/*!
+\file       EntitySet.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration and implementation of EntitySet class.
+
+  EntitySet is a sparse set of entity IDs:
+  - Dense array of entity IDs (Iterated linearly, no gaps).
+  - Sparse array indexed by entity ID, storing the index into the dense array
+  (Grows by pages as higher entity IDs are inserted).
+
+  insert, erase and contains are O(1). When an entity is erased, the last
+  entity in the dense array is moved into its spot, so the order of
+  entities is not kept and erasing while iterating is not allowed.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include "ECS.hpp"
+#include "PagedArray.hpp"
+
+#include <span>
+#include <vector>
+#include <algorithm>
+#include <limits>
+
+namespace Engine
+{
+	class EntitySet
+	{
+	public:
+		bool insert(EntityID e);
+		// Inserts all entities, growing the containers once
+		void insert(std::span<const EntityID> entities);
+		bool erase(EntityID e);
+		bool contains(EntityID e) const;
+		void clear();
+
+		std::size_t size() const;
+		bool empty() const;
+
+		const EntityID* begin() const;
+		const EntityID* end() const;
+
+	private:
+		static constexpr std::uint32_t INVALID_INDEX = (std::numeric_limits<std::uint32_t>::max)();
+
+		std::vector<EntityID> mDense{};
+		PagedArray<std::uint32_t, ENTITY_PAGE_SIZE> mSparse{ INVALID_INDEX };
+	};
+
+
+	// Class functions implementations (inline as they are called per entity)
+
+	inline bool EntitySet::insert(EntityID e)
+	{
+		if (contains(e))
+		{
+			return false;
+		}
+
+		if (e >= mSparse.Size())
+		{
+			mSparse.Resize(static_cast<std::size_t>(e) + 1);
+		}
+
+		mSparse[e] = static_cast<std::uint32_t>(mDense.size());
+		mDense.emplace_back(e);
+		return true;
+	}
+
+
+	inline void EntitySet::insert(std::span<const EntityID> entities)
+	{
+		if (entities.empty())
+		{
+			return;
+		}
+
+		mDense.reserve(mDense.size() + entities.size());
+		mSparse.Resize(static_cast<std::size_t>(*std::max_element(entities.begin(), entities.end())) + 1);
+
+		for (EntityID e : entities)
+		{
+			insert(e);
+		}
+	}
+
+
+	inline bool EntitySet::erase(EntityID e)
+	{
+		if (!contains(e))
+		{
+			return false;
+		}
+
+		// Move last entity into erased entity's spot
+		const std::uint32_t index = mSparse[e];
+		const EntityID last = mDense.back();
+		mDense[index] = last;
+		mSparse[last] = index;
+
+		mDense.pop_back();
+		mSparse[e] = INVALID_INDEX;
+		return true;
+	}
+
+
+	inline bool EntitySet::contains(EntityID e) const
+	{
+		return e < mSparse.Size() && mSparse[e] != INVALID_INDEX;
+	}
+
+
+	inline void EntitySet::clear()
+	{
+		for (EntityID e : mDense)
+		{
+			mSparse[e] = INVALID_INDEX;
+		}
+		mDense.clear();
+	}
+
+
+	inline std::size_t EntitySet::size() const
+	{
+		return mDense.size();
+	}
+
+
+	inline bool EntitySet::empty() const
+	{
+		return mDense.empty();
+	}
+
+
+	inline const EntityID* EntitySet::begin() const
+	{
+		return mDense.data();
+	}
+
+
+	inline const EntityID* EntitySet::end() const
+	{
+		return mDense.data() + mDense.size();
+	}
+
+} // end of namespace
@@ -0,0 +1,136 @@
+/******************************************************************************/
+/*!
+\file       Hierarchy.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration of Hierarchy class.
+
+  Hierarchy stores the parent-child graph intrusively, a Node per entity ID
+  (parent, first/last child, previous/next sibling, depth), so walking the
+  children of an entity follows sibling links without any lookups or copies.
+  Children are kept in the order they were attached.
+
+  All entities are also kept in a flat depth-first order (GetOrder), where
+  a parent is always before its children and every subtree is contiguous:
+  - GetSubtree(e) is a span of e and all of its descendants (No recursion).
+  - Iterating GetOrder visits parents before children (Eg: transforms).
+  The order is updated incrementally, no rebuilding:
+  - Attach/Detach rotate the subtree's range into place, which moves and
+  reindexes every entity between its old and new position. Detach moves it
+  right after its former root's subtree, so it costs at most that subtree's
+  size. Attach costs the distance between the subtree and its new parent's
+  range, attaching far apart entities of a large scene is O(entities).
+  - Remove closes the gaps of the removed subtrees in one pass that starts at
+  the first removed entity (Recently added entities are cheap to remove).
+
+  Spans returned are invalidated by Add, Remove, Attach and Detach.
+
+  Attach/Detach stamp the entity with a change tick (Node::version), so
+  systems can tell that its parent changed (Eg: world transforms). Stamped
+  entities are also logged, so GetChanges finds them without visiting every
+  node, until TrimChanges drops them (Coordinator, once every system saw them).
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include "ECS.hpp"
+#include "PagedArray.hpp"
+
+#include <span>
+#include <limits>
+#include <vector>
+
+namespace Engine
+{
+	class Hierarchy
+	{
+	public:
+		struct Node
+		{
+			EntityID parent = INVALID_ENTITY;
+			EntityID firstChild = INVALID_ENTITY;
+			EntityID lastChild = INVALID_ENTITY;
+			EntityID prevSibling = INVALID_ENTITY;
+			EntityID nextSibling = INVALID_ENTITY;
+			std::uint32_t depth = 0;            // 0 for root entities
+			std::uint32_t index = INVALID_INDEX; // Position in GetOrder()
+			std::uint32_t size = 0;             // Entity and all of its descendants
+			Tick version = 0;                   // Change tick of the last Attach/Detach
+		};
+
+		struct Change
+		{
+			EntityID entity;
+			Tick tick;
+		};
+
+		// Adds entity as a root, at the end of the order
+		void Add(EntityID e);
+		// Adds entities as roots, at the end of the order in the span's order
+		void Add(std::span<const EntityID> entities);
+		// Removes entities, descendants of an entity must be in the span too (Sorted, no duplicates)
+		void Remove(std::span<const EntityID> entities);
+		void Clear();
+
+		// Makes child the last child of parent (Detached from its current parent first)
+		// Returns false if parent is child or one of its descendants
+		bool Attach(EntityID parent, EntityID child, Tick tick = 0);
+		// Makes child a root entity, its subtree is moved right after its former root's subtree
+		void Detach(EntityID child, Tick tick = 0);
+
+		bool Contains(EntityID e) const;
+		// No checks, entity must be in the hierarchy
+		const Node& GetNode(EntityID e) const;
+		EntityID GetParent(EntityID e) const;
+		EntityID GetFirstChild(EntityID e) const;
+		EntityID GetNextSibling(EntityID e) const;
+		std::uint32_t GetDepth(EntityID e) const;
+
+		// Whether e is a descendant of ancestor (Range check, no walking up)
+		bool IsDescendant(EntityID ancestor, EntityID e) const;
+
+		// Entity followed by all of its descendants in depth-first order
+		std::span<const EntityID> GetSubtree(EntityID e) const;
+		// All entities in depth-first order
+		std::span<const EntityID> GetOrder() const;
+
+		// Entities stamped after since, oldest first (May have been removed since)
+		std::span<const Change> GetChanges(Tick since) const;
+		// Drops changes stamped at or before tick
+		void TrimChanges(Tick tick);
+
+	private:
+		static constexpr std::uint32_t INVALID_INDEX = (std::numeric_limits<std::uint32_t>::max)();
+
+		// Moves count entities at from to be right before the entity at to (Index before the move)
+		void Move(std::uint32_t from, std::uint32_t count, std::uint32_t to);
+		// Updates Node::index of entities in [begin, end) of mOrder
+		void Reindex(std::size_t begin, std::size_t end);
+		// Adds delta to the depth of every entity in e's subtree
+		void AddDepth(EntityID e, std::int64_t delta);
+		// Adds delta to the size of e and all of its ancestors
+		void AddSize(EntityID e, std::int64_t delta);
+		// Removes child from its parent's children (Links only)
+		void Unlink(EntityID child);
+		// Stamps entity with tick and logs it (Unless tick is 0)
+		void Stamp(EntityID e, Tick tick);
+
+		// Index corresponds to EntityID
+		PagedArray<Node, ENTITY_PAGE_SIZE> mNodes{};
+
+		// Depth-first order of all entities
+		std::vector<EntityID> mOrder{};
+
+		// Stamped entities, ticks never decrease
+		std::vector<Change> mChanges{};
+	};
+
+} // end of namespace
@@ -0,0 +1,165 @@
+/******************************************************************************/
+/*!
+\file       PagedArray.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration and implementation of PagedArray class.
+
+  PagedArray is an array that grows by fixed-size pages (PageSize elements)
+  instead of reallocating. It is used for containers indexed by entity ID, so
+  they only take as much memory as the highest entity ID in use needs.
+
+  - Growing never moves existing elements (addresses stay valid).
+  - Growing only costs the allocation of the new pages (no copying of the
+  existing elements).
+  - operator[] has no checks, call Resize (or check Size) first.
+  - Copying copies page by page, assigning reuses the pages that are already
+  allocated (Eg: restoring snapshots every frame does not allocate).
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <algorithm>
+
+namespace Engine
+{
+	// T - Element type, PageSize - Number of elements per page (Power of 2)
+	template <typename T, std::size_t PageSize>
+	class PagedArray
+	{
+	public:
+		static_assert(PageSize > 0 && (PageSize & (PageSize - 1)) == 0, "PageSize must be a power of 2.");
+
+		// value - Value of newly allocated elements
+		PagedArray(const T& value = T{});
+
+		PagedArray(const PagedArray& rhs);
+		PagedArray& operator=(const PagedArray& rhs);
+		PagedArray(PagedArray&&) = default;
+		PagedArray& operator=(PagedArray&&) = default;
+
+		T& operator[](std::size_t index);
+		const T& operator[](std::size_t index) const;
+
+		// Allocates pages until index size - 1 is valid
+		void Resize(std::size_t size);
+
+		// Number of valid elements (Multiple of PageSize)
+		std::size_t Size() const;
+
+		// Sets all allocated elements to value
+		void Fill(const T& value);
+
+		// Releases all pages
+		void Clear();
+
+	private:
+		std::vector<std::unique_ptr<T[]>> mPages{};
+		T mValue{};
+	};
+
+
+	// Templated class functions implementations
+
+	template <typename T, std::size_t PageSize>
+	PagedArray<T, PageSize>::PagedArray(const T& value) : mValue{ value }
+	{
+	}
+
+
+	template <typename T, std::size_t PageSize>
+	PagedArray<T, PageSize>::PagedArray(const PagedArray& rhs) : mValue{ rhs.mValue }
+	{
+		*this = rhs;
+	}
+
+
+	template <typename T, std::size_t PageSize>
+	PagedArray<T, PageSize>& PagedArray<T, PageSize>::operator=(const PagedArray& rhs)
+	{
+		if (this == &rhs)
+		{
+			return *this;
+		}
+
+		mValue = rhs.mValue;
+
+		// Keep pages that are already allocated, only the missing ones are allocated
+		if (mPages.size() > rhs.mPages.size())
+		{
+			mPages.resize(rhs.mPages.size());
+		}
+		while (mPages.size() < rhs.mPages.size())
+		{
+			mPages.emplace_back(std::make_unique<T[]>(PageSize));
+		}
+
+		for (std::size_t i = 0; i < mPages.size(); ++i)
+		{
+			std::copy(rhs.mPages[i].get(), rhs.mPages[i].get() + PageSize, mPages[i].get());
+		}
+		return *this;
+	}
+
+
+	template <typename T, std::size_t PageSize>
+	T& PagedArray<T, PageSize>::operator[](std::size_t index)
+	{
+		return mPages[index / PageSize][index % PageSize];
+	}
+
+
+	template <typename T, std::size_t PageSize>
+	const T& PagedArray<T, PageSize>::operator[](std::size_t index) const
+	{
+		return mPages[index / PageSize][index % PageSize];
+	}
+
+
+	template <typename T, std::size_t PageSize>
+	void PagedArray<T, PageSize>::Resize(std::size_t size)
+	{
+		while (Size() < size)
+		{
+			auto page = std::make_unique<T[]>(PageSize);
+			std::fill(page.get(), page.get() + PageSize, mValue);
+			mPages.emplace_back(std::move(page));
+		}
+	}
+
+
+	template <typename T, std::size_t PageSize>
+	std::size_t PagedArray<T, PageSize>::Size() const
+	{
+		return mPages.size() * PageSize;
+	}
+
+
+	template <typename T, std::size_t PageSize>
+	void PagedArray<T, PageSize>::Fill(const T& value)
+	{
+		for (auto& page : mPages)
+		{
+			std::fill(page.get(), page.get() + PageSize, value);
+		}
+	}
+
+
+	template <typename T, std::size_t PageSize>
+	void PagedArray<T, PageSize>::Clear()
+	{
+		mPages.clear();
+	}
+
+} // end of namespace
@@ -0,0 +1,276 @@
+/******************************************************************************/
+/*!
+\file       Query.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration and implementation of Exclude, Query,
+  QueryManager and ComponentView class.
+
+  A Query caches the entities that have all of the included components and
+  none of the excluded components. Queries are created the first time they
+  are requested through Coordinator::View/Each, and are kept up to date
+  incrementally whenever an entity's signature changes (No rebuilding).
+
+  ComponentView is a lightweight handle over a Query's entities. It holds raw
+  pointers to the component arrays of Ts, so retrieving a component is a
+  direct sparse -> dense index instead of a GetComponent call per entity.
+
+  Components of a view can be const (Eg: View<const Transform>), which gives
+  const references and does not change the components' versions, so systems
+  that only read a component do not mark it as changed.
+
+  Changed<Us...>{ tick } filters Each to entities that had any of Us changed
+  after tick (Eg: the system's mLastRunTick), so unchanged entities are
+  skipped without processing.
+
+  Usage:
+  for (EntityID e : coordinator.View<Transform, Particle>(Exclude<Camera>{}))
+  coordinator.Each<Transform, Particle>([](EntityID e, Transform& t, Particle& p) {});
+  coordinator.Each<const Transform>(Changed<Transform>{ mLastRunTick }, [](EntityID e, const Transform& t) {});
+
+  Adding/removing components or destroying entities that are part of a view
+  while iterating it is not allowed (Entities are moved to stay packed).
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include "ECS.hpp"
+#include "EntitySet.hpp"
+#include "ComponentManager.hpp"
+#include "TypeID.hpp"
+
+#include <span>
+#include <tuple>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace Engine
+{
+	// Components that entities of a view must not have
+	template <typename... Us>
+	struct Exclude {};
+
+
+	// Entities of a view that had any of Us changed after since
+	template <typename... Us>
+	struct Changed
+	{
+		Tick since = 0;
+	};
+
+
+	class Query
+	{
+	public:
+		Query(const Signature& include, const Signature& exclude);
+
+		bool Matches(const Signature& signature) const;
+
+		// Adds/removes entity from the cached entities based on its new signature
+		void EntitySignatureChanged(EntityID e, const Signature& signature);
+		void EntitiesCreated(std::span<const EntityID> entities, const Signature& signature);
+		void EntityDestroyed(EntityID e);
+		void EntitiesDestroyed(std::span<const EntityID> entities);
+
+		const EntitySet& GetEntities() const;
+		// Replaces the cached entities (Restoring snapshots)
+		void SetEntities(const EntitySet& entities);
+
+	private:
+		Signature mInclude{};
+		Signature mExclude{};
+		EntitySet mEntities{};
+	};
+
+
+	class QueryManager
+	{
+	public:
+		// Key - Unique type per combination of included and excluded components
+		template <typename Key>
+		Query* GetQuery();
+
+		template <typename Key>
+		Query& CreateQuery(const Signature& include, const Signature& exclude);
+
+		void EntitySignatureChanged(EntityID e, const Signature& signature);
+		// New entities that all have the same signature, each query is matched once
+		void EntitiesCreated(std::span<const EntityID> entities, const Signature& signature);
+		void DestroyEntity(EntityID e);
+		// Each query is visited once for all entities
+		void DestroyEntities(std::span<const EntityID> entities);
+
+		// Copies the cached entities of every query (Index corresponds to query ID, empty if not created)
+		void Snapshot(std::vector<std::optional<EntitySet>>& sets) const;
+		// Replaces the cached entities of queries with sets', queries created after the snapshot are
+		// emptied and refill(Query&) is called to match the entities again
+		template <typename Func>
+		void Restore(const std::vector<std::optional<EntitySet>>& sets, Func refill);
+
+		void Clear();
+
+	private:
+		// Index corresponds to TypeID<Query>::Get<Key>(), nullptr if not created yet
+		std::vector<std::unique_ptr<Query>> mQueries{};
+
+		// Created queries, to be iterated when a signature changes
+		std::vector<Query*> mActiveQueries{};
+	};
+
+
+	// Key type of a query, order of components matters
+	template <typename Included, typename Excluded>
+	struct QueryKey {};
+
+
+	// Ts - Components of the view (const Ts are read only)
+	template <typename... Ts>
+	class ComponentView
+	{
+	public:
+		ComponentView(const EntitySet& entities, ComponentManager& manager);
+
+		const EntityID* begin() const;
+		const EntityID* end() const;
+		std::size_t Size() const;
+
+		// No checks, entity must be part of the view. Non-const T marks the component as changed
+		// StorageMode::Archetype looks the component up by entity (Slower, see StorageMode)
+		template <typename T>
+		T& Get(EntityID e);
+
+		// Calls func(EntityID, Ts&...) for every entity in the view
+		template <typename Func>
+		void Each(Func func);
+
+	private:
+		const EntitySet* mEntities = nullptr;
+		ComponentManager* mComponentManager = nullptr;
+
+		// nullptr for StorageMode::Archetype (Components are retrieved from ComponentManager)
+		std::tuple<ComponentArray<std::remove_const_t<Ts>>*...> mArrays{};
+	};
+
+
+	// Templated class functions implementations
+
+	template <typename Key>
+	Query* QueryManager::GetQuery()
+	{
+		const std::size_t id = TypeID<Query>::Get<Key>();
+		return id < mQueries.size() ? mQueries[id].get() : nullptr;
+	}
+
+
+	template <typename Key>
+	Query& QueryManager::CreateQuery(const Signature& include, const Signature& exclude)
+	{
+		const std::size_t id = TypeID<Query>::Get<Key>();
+		if (id >= mQueries.size())
+		{
+			mQueries.resize(id + 1);
+		}
+
+		LOG_ASSERT(mQueries[id] == nullptr && "Creating query more than once.");
+
+		mQueries[id] = std::make_unique<Query>(include, exclude);
+		mActiveQueries.emplace_back(mQueries[id].get());
+		return *mQueries[id];
+	}
+
+
+	template <typename Func>
+	void QueryManager::Restore(const std::vector<std::optional<EntitySet>>& sets, Func refill)
+	{
+		for (std::size_t id = 0; id < mQueries.size(); ++id)
+		{
+			if (!mQueries[id])
+			{
+				continue;
+			}
+
+			if (id < sets.size() && sets[id])
+			{
+				mQueries[id]->SetEntities(*sets[id]);
+			}
+			else
+			{
+				mQueries[id]->SetEntities(EntitySet{});
+				refill(*mQueries[id]);
+			}
+		}
+	}
+
+
+	template <typename... Ts>
+	ComponentView<Ts...>::ComponentView(const EntitySet& entities, ComponentManager& manager) :
+		mEntities{ &entities }, mComponentManager{ &manager }
+	{
+		if (manager.GetStorageMode() == StorageMode::Pool)
+		{
+			mArrays = std::make_tuple(manager.GetComponentArray<std::remove_const_t<Ts>>().get()...);
+		}
+	}
+
+
+	template <typename... Ts>
+	const EntityID* ComponentView<Ts...>::begin() const
+	{
+		return mEntities->begin();
+	}
+
+
+	template <typename... Ts>
+	const EntityID* ComponentView<Ts...>::end() const
+	{
+		return mEntities->end();
+	}
+
+
+	template <typename... Ts>
+	std::size_t ComponentView<Ts...>::Size() const
+	{
+		return mEntities->size();
+	}
+
+
+	template <typename... Ts>
+	template <typename T>
+	T& ComponentView<Ts...>::Get(EntityID e)
+	{
+		using U = std::remove_const_t<T>;
+
+		if (ComponentArray<U>* array = std::get<ComponentArray<U>*>(mArrays))
+		{
+			if constexpr (!std::is_const_v<T>)
+			{
+				mComponentManager->MarkChanged<U>(e);
+			}
+			return array->Get(e);
+		}
+
+		return *mComponentManager->GetComponent<T>(e);
+	}
+
+
+	template <typename... Ts>
+	template <typename Func>
+	void ComponentView<Ts...>::Each(Func func)
+	{
+		for (EntityID e : *mEntities)
+		{
+			func(e, Get<Ts>(e)...);
+		}
+	}
+
+} // end of namespace
@@ -0,0 +1,128 @@
+/******************************************************************************/
+/*!
+\file       RingBuffer.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration and implementation of RingBuffer class.
+
+  RingBuffer is a FIFO queue over a power of 2 sized array, where the front
+  and back wrap around instead of moving elements. Pushing and popping never
+  allocate, unless it is full, then the capacity is doubled (Elements are
+  copied in FIFO order once).
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+namespace Engine
+{
+	template <typename T>
+	class RingBuffer
+	{
+	public:
+		// capacity - Rounded up to a power of 2
+		explicit RingBuffer(std::size_t capacity = 64);
+
+		void Push(const T& value);
+		// No checks, call Empty first
+		T& Front();
+		void Pop();
+
+		std::size_t Size() const;
+		bool Empty() const;
+		void Clear();
+
+	private:
+		void Grow();
+
+		std::vector<T> mData{};
+		std::size_t mHead = 0; // Index of the front element
+		std::size_t mSize = 0;
+	};
+
+
+	// Templated class functions implementations
+
+	template <typename T>
+	RingBuffer<T>::RingBuffer(std::size_t capacity)
+	{
+		std::size_t size = 1;
+		while (size < capacity)
+		{
+			size <<= 1;
+		}
+		mData.resize(size);
+	}
+
+
+	template <typename T>
+	void RingBuffer<T>::Push(const T& value)
+	{
+		if (mSize == mData.size())
+		{
+			Grow();
+		}
+
+		mData[(mHead + mSize) & (mData.size() - 1)] = value;
+		++mSize;
+	}
+
+
+	template <typename T>
+	T& RingBuffer<T>::Front()
+	{
+		return mData[mHead];
+	}
+
+
+	template <typename T>
+	void RingBuffer<T>::Pop()
+	{
+		mHead = (mHead + 1) & (mData.size() - 1);
+		--mSize;
+	}
+
+
+	template <typename T>
+	std::size_t RingBuffer<T>::Size() const
+	{
+		return mSize;
+	}
+
+
+	template <typename T>
+	bool RingBuffer<T>::Empty() const
+	{
+		return mSize == 0;
+	}
+
+
+	template <typename T>
+	void RingBuffer<T>::Clear()
+	{
+		mHead = 0;
+		mSize = 0;
+	}
+
+
+	template <typename T>
+	void RingBuffer<T>::Grow()
+	{
+		// Unwrap so the front is at index 0
+		std::rotate(mData.begin(), mData.begin() + mHead, mData.end());
+		mData.resize(mData.size() * 2);
+		mHead = 0;
+	}
+
+} // end of namespace
@@ -0,0 +1,294 @@
+/******************************************************************************/
+/*!
+\file       Signature.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration and implementation of BitSignature class.
+
+  BitSignature is a fixed-size bitset of 64, 128 or 256 bits (1 bit per
+  component type) that replaces std::bitset for Signature. It has the subset of
+  std::bitset functions used by the ECS (set, reset, test, none) and:
+  - Contains(sub), whether all bits of sub are set ((*this & sub) == sub).
+  - Intersects(other), whether any bit is set in both ((*this & other).any()).
+
+  Contains and Intersects are what systems, queries and archetypes match
+  entities with, so they are done with SIMD when available:
+  - 128 bits, SSE2 (SSE4.1 ptest if available).
+  - 256 bits, AVX vptest (else 2x SSE).
+  - 64 bits, a single 64-bit integer operation.
+
+  Width is chosen with ECS_SIGNATURE_BITS (See ECS.hpp). The x64 builds of
+  the project are compiled with /arch:AVX2, which makes MSVC define __AVX__
+  (MSVC never defines __SSE4_1__), so the ptest/vptest paths are the ones
+  used. Win32 builds only get SSE2.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ECS_SIGNATURE_SSE2
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define ECS_SIGNATURE_SSE41
+#endif
+
+#if defined(__AVX__)
+#define ECS_SIGNATURE_AVX
+#endif
+
+namespace Engine
+{
+	// Bits - Number of bits (64, 128 or 256)
+	template <std::size_t Bits>
+	class BitSignature
+	{
+	public:
+		static_assert(Bits == 64 || Bits == 128 || Bits == 256, "Signature must be 64, 128 or 256 bits.");
+
+		BitSignature& set(std::size_t pos, bool value = true);
+		BitSignature& reset(std::size_t pos);
+		BitSignature& reset();
+
+		bool test(std::size_t pos) const;
+		bool none() const;
+		bool any() const;
+		constexpr std::size_t size() const { return Bits; }
+
+		// Whether all bits of sub are set in this signature
+		bool Contains(const BitSignature& sub) const;
+		// Whether any bit is set in both signatures
+		bool Intersects(const BitSignature& other) const;
+
+		BitSignature operator&(const BitSignature& rhs) const;
+		BitSignature operator|(const BitSignature& rhs) const;
+		BitSignature operator^(const BitSignature& rhs) const;
+		bool operator==(const BitSignature& rhs) const;
+		bool operator!=(const BitSignature& rhs) const;
+
+		std::size_t Hash() const;
+
+	private:
+		static constexpr std::size_t WORDS = Bits / 64;
+
+		alignas(Bits / 8) std::array<std::uint64_t, WORDS> mWords{};
+	};
+
+
+	// Templated class functions implementations
+
+	template <std::size_t Bits>
+	BitSignature<Bits>& BitSignature<Bits>::set(std::size_t pos, bool value)
+	{
+		const std::uint64_t mask = std::uint64_t{ 1 } << (pos % 64);
+		if (value)
+		{
+			mWords[pos / 64] |= mask;
+		}
+		else
+		{
+			mWords[pos / 64] &= ~mask;
+		}
+		return *this;
+	}
+
+
+	template <std::size_t Bits>
+	BitSignature<Bits>& BitSignature<Bits>::reset(std::size_t pos)
+	{
+		return set(pos, false);
+	}
+
+
+	template <std::size_t Bits>
+	BitSignature<Bits>& BitSignature<Bits>::reset()
+	{
+		mWords.fill(0);
+		return *this;
+	}
+
+
+	template <std::size_t Bits>
+	bool BitSignature<Bits>::test(std::size_t pos) const
+	{
+		return (mWords[pos / 64] >> (pos % 64)) & 1;
+	}
+
+
+	template <std::size_t Bits>
+	bool BitSignature<Bits>::none() const
+	{
+		return !Intersects(*this);
+	}
+
+
+	template <std::size_t Bits>
+	bool BitSignature<Bits>::any() const
+	{
+		return Intersects(*this);
+	}
+
+
+	template <std::size_t Bits>
+	bool BitSignature<Bits>::Contains(const BitSignature& sub) const
+	{
+		// No bit of sub is missing, (~this & sub) == 0
+#if defined(ECS_SIGNATURE_AVX)
+		if constexpr (Bits == 256)
+		{
+			const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mWords.data()));
+			const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(sub.mWords.data()));
+			return _mm256_testc_si256(a, b);
+		}
+#endif
+#if defined(ECS_SIGNATURE_SSE2)
+		if constexpr (Bits >= 128)
+		{
+			bool result = true;
+			for (std::size_t i = 0; i < WORDS; i += 2)
+			{
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mWords.data() + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sub.mWords.data() + i));
+#if defined(ECS_SIGNATURE_SSE41)
+				result &= _mm_testc_si128(a, b) != 0;
+#else
+				const __m128i missing = _mm_andnot_si128(a, b);
+				result &= _mm_movemask_epi8(_mm_cmpeq_epi8(missing, _mm_setzero_si128())) == 0xFFFF;
+#endif
+			}
+			return result;
+		}
+#endif
+		std::uint64_t missing = 0;
+		for (std::size_t i = 0; i < WORDS; ++i)
+		{
+			missing |= ~mWords[i] & sub.mWords[i];
+		}
+		return missing == 0;
+	}
+
+
+	template <std::size_t Bits>
+	bool BitSignature<Bits>::Intersects(const BitSignature& other) const
+	{
+#if defined(ECS_SIGNATURE_AVX)
+		if constexpr (Bits == 256)
+		{
+			const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mWords.data()));
+			const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(other.mWords.data()));
+			return !_mm256_testz_si256(a, b);
+		}
+#endif
+#if defined(ECS_SIGNATURE_SSE2)
+		if constexpr (Bits >= 128)
+		{
+			bool result = false;
+			for (std::size_t i = 0; i < WORDS; i += 2)
+			{
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mWords.data() + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(other.mWords.data() + i));
+#if defined(ECS_SIGNATURE_SSE41)
+				result |= _mm_testz_si128(a, b) == 0;
+#else
+				const __m128i common = _mm_and_si128(a, b);
+				result |= _mm_movemask_epi8(_mm_cmpeq_epi8(common, _mm_setzero_si128())) != 0xFFFF;
+#endif
+			}
+			return result;
+		}
+#endif
+		std::uint64_t common = 0;
+		for (std::size_t i = 0; i < WORDS; ++i)
+		{
+			common |= mWords[i] & other.mWords[i];
+		}
+		return common != 0;
+	}
+
+
+	template <std::size_t Bits>
+	BitSignature<Bits> BitSignature<Bits>::operator&(const BitSignature& rhs) const
+	{
+		BitSignature result{};
+		for (std::size_t i = 0; i < WORDS; ++i)
+		{
+			result.mWords[i] = mWords[i] & rhs.mWords[i];
+		}
+		return result;
+	}
+
+
+	template <std::size_t Bits>
+	BitSignature<Bits> BitSignature<Bits>::operator|(const BitSignature& rhs) const
+	{
+		BitSignature result{};
+		for (std::size_t i = 0; i < WORDS; ++i)
+		{
+			result.mWords[i] = mWords[i] | rhs.mWords[i];
+		}
+		return result;
+	}
+
+
+	template <std::size_t Bits>
+	BitSignature<Bits> BitSignature<Bits>::operator^(const BitSignature& rhs) const
+	{
+		BitSignature result{};
+		for (std::size_t i = 0; i < WORDS; ++i)
+		{
+			result.mWords[i] = mWords[i] ^ rhs.mWords[i];
+		}
+		return result;
+	}
+
+
+	template <std::size_t Bits>
+	bool BitSignature<Bits>::operator==(const BitSignature& rhs) const
+	{
+		return mWords == rhs.mWords;
+	}
+
+
+	template <std::size_t Bits>
+	bool BitSignature<Bits>::operator!=(const BitSignature& rhs) const
+	{
+		return !(*this == rhs);
+	}
+
+
+	template <std::size_t Bits>
+	std::size_t BitSignature<Bits>::Hash() const
+	{
+		std::size_t hash = 0;
+		for (std::uint64_t word : mWords)
+		{
+			hash ^= std::hash<std::uint64_t>{}(word) + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+		}
+		return hash;
+	}
+
+} // end of namespace
+
+
+template <std::size_t Bits>
+struct std::hash<Engine::BitSignature<Bits>>
+{
+	std::size_t operator()(const Engine::BitSignature<Bits>& signature) const
+	{
+		return signature.Hash();
+	}
+};
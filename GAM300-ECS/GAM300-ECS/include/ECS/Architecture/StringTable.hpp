@@ -0,0 +1,67 @@
+/******************************************************************************/
+/*!
+\file       StringTable.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration of StringTable class.
+
+  StringTable interns strings, every distinct string is stored once and is
+  referred to by a StringID. Entities keep StringIDs of their name, prefab and
+  tag instead of std::strings, so copying an Entity never allocates, and
+  comparing two interned strings is comparing two integers.
+
+  - StringID 0 is always the empty string (Default of an Entity's strings).
+  - Strings are never removed, a StringID and its string_view stay valid
+  until the program ends.
+  - Not thread safe, intern strings on the main thread (Same as creating and
+  renaming entities).
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <deque>
+#include <limits>
+#include <string>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
+namespace Engine
+{
+	using StringID = std::uint32_t;
+
+	class StringTable
+	{
+	public:
+		static constexpr StringID EMPTY_STRING = 0;
+		static constexpr StringID INVALID_STRING = (std::numeric_limits<StringID>::max)();
+
+		// Returns ID of str, str is added if it has not been interned yet
+		static StringID Intern(std::string_view str);
+		// Returns ID of str, or INVALID_STRING if it has not been interned (Nothing is added)
+		static StringID Find(std::string_view str);
+		// No checks, id must be returned by Intern/Find
+		static std::string_view Get(StringID id);
+
+		// Number of interned strings (Including the empty string)
+		static std::size_t Size();
+
+	private:
+		StringTable();
+
+		static StringTable& Instance();
+
+		// Deque so strings are not moved as it grows (mIDs keys are views of them)
+		std::deque<std::string> mStrings{};
+		std::unordered_map<std::string_view, StringID> mIDs{};
+	};
+
+} // end of namespace
@@ -8,9 +8,13 @@
 \brief
   This file contains the declaration and implementation of System class.
 
-  The System class has only a std::set of entities. 
+  The System class has only a set of entities (EntitySet, packed array).
   Calls insert() and erase() to add and remove entities.
 
+  mLastRunTick is set by SystemScheduler to the change tick of the wave the
+  system last ran in, so Update can use Changed<T>{ mLastRunTick } to only
+  process entities changed by others since then.
+
   Copyright (C) 2022 DigiPen Institure of Technology.
   Reproduction or disclosure of this file or its contents
   without the prior written consent of DigiPen Institute of
@@ -20,7 +24,7 @@
 #pragma once
 
 #include "ECS.hpp"
-#include <set>
+#include "EntitySet.hpp"
 
 #define UNUSED(expr) (void)expr
 
@@ -36,7 +40,10 @@ namespace Engine
 		virtual void Update(Coordinator* coordinator, float deltaTime) { UNUSED(coordinator); UNUSED(deltaTime); }
 		virtual void Destroy() = 0;
 
-		std::set<EntityID> mEntities{};
+		EntitySet mEntities{};
+
+		// Change tick of the last Update (See Changed), 0 if it has not run
+		Tick mLastRunTick = 0;
 	};
 
 } // end of namespace
\ No newline at end of file
@@ -12,9 +12,17 @@
   systems and their signatures.
 
   Each system needs to have a signature set so that the manager can add the
-  appropriate entities to each system's std::set of entities.
+  appropriate entities to each system's set of entities.
 
-  std::set of entities should be updated whenever the entity's signature is updated.
+  Set of entities should be updated whenever the entity's signature is updated.
+  An entity belongs to a system if it matches any of the system's signatures.
+  For every component type, the manager keeps the systems that have the type
+  in their signatures, so a single component change only updates those systems.
+
+  Systems are indexed by their TypeID<System> in flat containers.
+
+  Systems are updated together through UpdateSystems, which runs them with a
+  SystemScheduler based on the component access each system declared.
 
   Copyright (C) 2022 DigiPen Institure of Technology.
   Reproduction or disclosure of this file or its contents
@@ -27,11 +35,15 @@
 #include "ECS.hpp"
 #include "System.hpp"
 #include "EntityManager.hpp"
+#include "TypeID.hpp"
+#include "SystemScheduler.hpp"
 #include "include/Logging.hpp"
 
-#include <set>
+#include <span>
+#include <array>
 #include <memory>
-#include <unordered_map>
+#include <vector>
+#include <algorithm>
 
 namespace Engine
 {
@@ -44,21 +56,62 @@ namespace Engine
 		template<typename T>
 		void SetSignature(Signature signature);
 
+		// Components system reads/writes, to be scheduled with
+		template<typename T>
+		void SetAccess(const SystemAccess& access);
+
+		// Updates all registered systems, concurrently on jobs if their access allows it
+		void UpdateSystems(Coordinator* coordinator, float deltaTime, JobSystem& jobs);
+
 		void DestroyEntity(Entity& e);
 		void DestroyEntity(EntityID& e);
+		// Each system is visited once for all entities
+		void DestroyEntities(std::span<const EntityID> entities);
 
 		void EntitySignatureChanged(Entity& e, Signature signature);
 		void EntitySignatureChanged(EntityID& e, Signature signature);
 
+		// Only updates systems that have the changed component type in their signatures
+		void EntitySignatureChanged(EntityID e, Signature signature, ComponentType changed);
+		// Only updates systems that have any of the changed component types in their signatures
+		void EntitySignatureChanged(EntityID e, const Signature& signature, const Signature& changed);
+
+		// New entities that all have the same signature, each system is matched once
+		void EntitiesCreated(std::span<const EntityID> entities, const Signature& signature);
+
+		// Copies the entities of every system (Index corresponds to TypeID<System>), reusing sets' memory
+		void Snapshot(std::vector<EntitySet>& sets) const;
+		// Replaces the entities of every system with sets' (Systems are registered before any snapshot)
+		void Restore(const std::vector<EntitySet>& sets);
+
 		template <typename T>
 		std::shared_ptr<System> GetSystem();
 
 	private:
-		// Map system name to signature
-		std::unordered_map<const char*, std::vector<Signature>> mSignatures{};
+		// Inserts/erases entity from system based on entity's signature
+		void UpdateSystemEntity(std::size_t id, EntityID e, const Signature& signature);
 
-		// Map system name to system pointer
-		std::unordered_map<const char*, std::shared_ptr<System>> mSystems{};
+		// Index corresponds to TypeID<System>::Get<T>(), system's signatures
+		std::vector<std::vector<Signature>> mSignatures{};
+
+		// Index corresponds to TypeID<System>::Get<T>(), nullptr if not registered
+		std::vector<std::shared_ptr<System>> mSystems{};
+
+		// Index corresponds to TypeID<System>::Get<T>(), union of system's signatures
+		std::vector<Signature> mSignatureMasks{};
+
+		// Index corresponds to ComponentType, IDs of systems that have the type in their signatures
+		std::array<std::vector<std::size_t>, MAX_COMPONENTS> mInterestedSystems{};
+
+		// Index corresponds to TypeID<System>::Get<T>(), components system reads/writes
+		std::vector<SystemAccess> mAccess{};
+
+		// IDs of systems in registration order (Update order of conflicting systems)
+		std::vector<std::size_t> mRegistrationOrder{};
+
+		// Rebuilt on the next UpdateSystems if systems or access changed
+		SystemScheduler mScheduler{};
+		bool mScheduleDirty = true;
 	};
 
 
@@ -67,49 +120,84 @@ namespace Engine
 	template<typename T>
 	void SystemManager::RegisterSystem()
 	{
-		const char* name = typeid(T).name();
+		const std::size_t id = TypeID<System>::Get<T>();
 
-		if (mSystems.find(name) != mSystems.end())
+		if (id < mSystems.size() && mSystems[id])
 		{
 			LOG_WARNING("Registering system more than once.");
 			return;
 		}
 
-		// Create a system pointer and add it to map
-		auto system = std::make_shared<T>();
-		mSystems.insert({ name, system });
+		if (id >= mSystems.size())
+		{
+			mSystems.resize(id + 1);
+			mSignatures.resize(id + 1);
+			mSignatureMasks.resize(id + 1);
+			mAccess.resize(id + 1);
+		}
+
+		// Create a system pointer and add it to container
+		mSystems[id] = std::make_shared<T>();
+		mRegistrationOrder.emplace_back(id);
+		mScheduleDirty = true;
 	}
 
 
 	template<typename T>
 	void SystemManager::SetSignature(Signature signature)
 	{
-		const char* name = typeid(T).name();
+		const std::size_t id = TypeID<System>::Get<T>();
 
-		if (mSystems.find(name) == mSystems.end())
+		if (id >= mSystems.size() || mSystems[id] == nullptr)
 		{
 			LOG_WARNING("System is not registered.");
 			return;
 		}
 		
 		// Set signature
-		std::vector<Signature>& signatures = mSignatures[name];
-		signatures.emplace_back(signature);
+		mSignatures[id].emplace_back(signature);
+		mSignatureMasks[id] = mSignatureMasks[id] | signature;
+
+		for (std::size_t type = 0; type < MAX_COMPONENTS; ++type)
+		{
+			std::vector<std::size_t>& systems = mInterestedSystems[type];
+			if (signature.test(type) && std::find(systems.begin(), systems.end(), id) == systems.end())
+			{
+				systems.emplace_back(id);
+			}
+		}
+	}
+
+
+	template<typename T>
+	void SystemManager::SetAccess(const SystemAccess& access)
+	{
+		const std::size_t id = TypeID<System>::Get<T>();
+
+		if (id >= mSystems.size() || mSystems[id] == nullptr)
+		{
+			LOG_WARNING("System is not registered.");
+			return;
+		}
+
+		mAccess[id] = access;
+		mAccess[id].declared = true;
+		mScheduleDirty = true;
 	}
 
 
 	template <typename T>
 	std::shared_ptr<System> SystemManager::GetSystem()
 	{
-		const char* name = typeid(T).name();
+		const std::size_t id = TypeID<System>::Get<T>();
 
-		if (mSystems.find(name) == mSystems.end())
+		if (id >= mSystems.size() || mSystems[id] == nullptr)
 		{
 			LOG_WARNING("System is not registered.");
 			return nullptr;
 		}
 
-		return mSystems.find(name)->second;
+		return mSystems[id];
 	}
 
 } // end of namespace
\ No newline at end of file
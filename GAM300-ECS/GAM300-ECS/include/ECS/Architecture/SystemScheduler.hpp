@@ -0,0 +1,97 @@
+/******************************************************************************/
+/*!
+\file       SystemScheduler.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration of Read, Write, SystemAccess and
+  SystemScheduler class.
+
+  Each system declares the component types it reads and writes (See
+  Coordinator::AssignSystemAccess). The scheduler builds a dependency graph in
+  registration order, where a system depends on every earlier system it
+  conflicts with:
+  - Either system writes a component type that the other reads or writes.
+  - Either system did not declare its access (It runs alone).
+  - Both systems must run on the main thread (Registration order is kept).
+
+  Systems are grouped into waves by their depth in the graph (A system is in
+  the wave after the last system it depends on), so systems in the same wave
+  never conflict. Waves run one after another, so conflicting systems always
+  run in registration order (Deterministic), while the systems of a wave are
+  updated concurrently as jobs (See JobSystem). Main thread systems (Eg: systems
+  that make OpenGL calls) are run by the thread that calls Run, which also
+  runs other jobs until the wave is done.
+
+  Every wave starts a new change tick, which is the mLastRunTick of its
+  systems (See System::mLastRunTick). A system does not see its own changes
+  as changed on its next run, but sees the changes of every other system
+  (Earlier or later in the frame), as those are in other waves.
+
+  Systems updated as jobs must not add/remove components, create/destroy
+  entities or create queries (See Coordinator::PrepareQuery), as the managers
+  are not thread safe.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include "ECS.hpp"
+#include "System.hpp"
+#include "include/Job/JobSystem.hpp"
+
+#include <vector>
+
+namespace Engine
+{
+	// Components that a system reads/writes
+	template <typename... Ts>
+	struct Read {};
+	template <typename... Ts>
+	struct Write {};
+
+
+	struct SystemAccess
+	{
+		Signature reads{};
+		Signature writes{};
+		bool declared = false;
+		bool mainThread = false;
+	};
+
+
+	class SystemScheduler
+	{
+	public:
+		// systems and access - Registered systems in registration order
+		void Build(const std::vector<System*>& systems, const std::vector<SystemAccess>& access);
+
+		// Updates every system once, returns when all systems are done
+		void Run(Coordinator* coordinator, float deltaTime, JobSystem& jobs);
+
+		// Whether a and b must not run at the same time
+		static bool Conflicts(const SystemAccess& a, const SystemAccess& b);
+
+	private:
+		struct Node
+		{
+			System* system = nullptr;
+			bool mainThread = false;
+		};
+
+		// Updates the systems of a wave with a new change tick, returns when all are done
+		void RunWave(const std::vector<std::size_t>& wave, Coordinator* coordinator, float deltaTime, JobSystem& jobs);
+
+		std::vector<Node> mNodes{};
+
+		// Nodes of each wave, in registration order
+		std::vector<std::vector<std::size_t>> mWaves{};
+	};
+
+} // end of namespace
@@ -0,0 +1,54 @@
+/******************************************************************************/
+/*!
+\file       TypeID.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration and implementation of TypeID class.
+
+  TypeID hands out a dense, static integer ID for every type T within a
+  Family (e.g. TypeID<IComponent> for components, TypeID<System> for systems).
+  IDs start from 0 and increase by one for every new T, so they can be used
+  to index flat containers instead of hashing typeid(T).name().
+
+  The ID of T is assigned the first time TypeID<Family>::Get<T>() is called
+  and stays the same for the rest of the application.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace Engine
+{
+	template <typename Family>
+	class TypeID
+	{
+	public:
+		template <typename T>
+		static std::size_t Get();
+
+	private:
+		static inline std::atomic<std::size_t> NextID{ 0 };
+	};
+
+
+	// Templated class functions implementations
+
+	template <typename Family>
+	template <typename T>
+	std::size_t TypeID<Family>::Get()
+	{
+		static const std::size_t id = NextID++;
+		return id;
+	}
+
+} // end of namespace
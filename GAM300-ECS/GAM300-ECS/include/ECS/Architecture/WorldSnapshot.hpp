@@ -0,0 +1,78 @@
+/******************************************************************************/
+/*!
+\file       WorldSnapshot.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration and implementation of WorldSnapshot
+  class.
+
+  WorldSnapshot holds a copy of a Coordinator's whole world, taken by
+  Coordinator::Snapshot and applied by Coordinator::Restore (Eg: rollback,
+  restoring the scene after play mode in the editor):
+  - Entity records (Signatures, generations, free list) and tags.
+  - Entity table, name lookup, hierarchy and active states.
+  - Every component array, trivially copyable components with a memcpy per
+  page, others copy constructed one by one.
+  - Entities of every system and query (Same iteration order once restored).
+
+  Taking a snapshot into the same WorldSnapshot again reuses its memory.
+  Only valid for StorageMode::Pool, and only for the coordinator it was taken
+  from (Same registered components and systems).
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include "Coordinator.hpp"
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <unordered_map>
+
+namespace Engine
+{
+	class WorldSnapshot
+	{
+	public:
+		// Whether a snapshot was taken into it
+		bool IsValid() const;
+
+	private:
+		friend class Coordinator;
+
+		bool mIsValid = false;
+
+		EntityManager mEntityManager{};
+		ComponentSnapshot mComponents{};
+		std::vector<EntitySet> mSystemEntities{};
+		std::vector<std::optional<EntitySet>> mQueryEntities{};
+
+		// Coordinator's containers
+		std::vector<Entity> mEntities{};
+		PagedArray<std::uint32_t, ENTITY_PAGE_SIZE> mEntityIndex{};
+		std::unordered_map<std::uint64_t, EntityID> mEntityNames{};
+		std::unordered_map<std::string, int> mNameSuffixes{};
+		Hierarchy mHierarchy{};
+		PagedArray<std::uint64_t, ENTITY_PAGE_SIZE / 64> mEffectiveActive{};
+		std::unordered_map<std::string, std::vector<EntityID>> mPrefabReloading{};
+		Coordinator::TimedDestroyQueue mTimedDestroys{};
+		double mTime = 0.0;
+	};
+
+
+	// Class functions implementations
+
+	inline bool WorldSnapshot::IsValid() const
+	{
+		return mIsValid;
+	}
+
+} // end of namespace
@@ -8,8 +8,8 @@
 \brief
   This file contains the declaration and implementation of Transform class.
   
-  It is just for me to play around and test whatever I am implementing at the 
-  moment.
+  position, scale and rot_q are relative to the parent entity's Transform,
+  the world* members are derived from them by TransformSystem.
 
   Copyright (C) 2022 DigiPen Institure of Technology.
   Reproduction or disclosure of this file or its contents
@@ -48,9 +48,16 @@ namespace Engine
 		glm::vec3 scale{ 1.f, 1.f, 1.f };
 		glm::quat rot_q{};
 
+		// Overridden parts are in world space instead of relative to the parent
 		bool isOverridePosition = false;
 		bool isOverrideScale = false;
 		bool isOverrideRotation = false;
+
+		// Local-to-world, computed by TransformSystem (Not serialized)
+		glm::vec3 worldPosition{ 0.f, 0.f, 0.f };
+		glm::vec3 worldScale{ 1.f, 1.f, 1.f };
+		glm::quat worldRotation{ 1.f, 0.f, 0.f, 0.f };
+		glm::mat4 worldMatrix{ 1.f };
 		
 		RTTR_ENABLE(IComponent);
 	};
@@ -8,8 +8,26 @@
 \brief
   This file contains the declaration of TransformSystem class.
 
-  It is just for me to play around and test whatever I am implementing at the
-  moment.
+  TransformSystem computes the world position/scale/rotation and matrix of
+  every Transform from its local values and its parent's world values
+  (Nearest ancestor with a Transform). isOverridePosition/Scale/Rotation
+  take that part as world space instead.
+
+  Only the subtrees of dirty entities are visited, in the hierarchy's
+  depth-first order, so parents are always computed before their children.
+  Entities are dirty if since the last update:
+  - Their Transform changed (See Changed).
+  - Their parent changed (Coordinator::ToChild/UnChild, see
+    Hierarchy::GetChanges).
+  Recomputed Transforms are stamped as changed, so systems updated after
+  TransformSystem see the children of a moved entity as changed too.
+
+  Subtrees small enough for a job are computed in parallel, entities with
+  larger subtrees are computed first on the calling thread.
+
+  The nearest Transform of every visited position is kept while walking the
+  order, so only the first entity of each batch or serial subtree searches
+  its ancestors for one.
 
   Copyright (C) 2022 DigiPen Institure of Technology.
   Reproduction or disclosure of this file or its contents
@@ -21,14 +39,50 @@
 
 #include "include/ECS/Architecture/System.hpp"
 
+#include <vector>
+#include <cstddef>
+
 namespace Engine
 {
+	class Hierarchy;
+	class Transform;
+
 	class TransformSystem : public System
 	{
 	public:
 		TransformSystem() = default;
 		void Init() override;
 		void Update() override;
+		void Update(Coordinator* coordinator, float deltaTime) override;
 		void Destroy() override;
+
+		// Sets world values of transform from its parent's world values (nullptr for root entities)
+		static void ComputeWorld(Transform& transform, const Transform* parent);
+
+	private:
+		// Range of positions in the hierarchy's order
+		struct Batch
+		{
+			std::size_t begin;
+			std::size_t end;
+		};
+
+		// Adds entity's subtree as batches, entities with larger subtrees go to mSerial
+		void Split(const Hierarchy& hierarchy, EntityID e, std::size_t grain);
+
+		// Nearest ancestor of e with a Transform, nullptr if none
+		static const Transform* FindParent(Coordinator* coordinator, const Hierarchy& hierarchy, EntityID e);
+
+		// Recomputes the entity at position of the hierarchy's order from parent (Its nearest ancestor's Transform)
+		void UpdateEntity(Coordinator* coordinator, const Hierarchy& hierarchy, std::size_t position, const Transform* parent);
+
+		// Positions in the hierarchy's order of the dirty entities
+		std::vector<std::size_t> mDirtyRoots{};
+
+		std::vector<std::size_t> mSerial{};
+		std::vector<Batch> mBatches{};
+
+		// Nearest Transform (Own or ancestor's) of each position computed this update
+		std::vector<const Transform*> mNearest{};
 	};
-}
\ No newline at end of file
+}
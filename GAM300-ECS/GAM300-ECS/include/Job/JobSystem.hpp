@@ -0,0 +1,182 @@
+/******************************************************************************/
+/*!
+\file       JobSystem.hpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the declaration and implementation of JobCounter and
+  JobSystem class.
+
+  JobSystem owns a worker thread per hardware thread (Minus the main thread),
+  each with its own deque of jobs:
+  - Jobs submitted by a worker go to the back of its own deque, and it takes
+  jobs from the back (Most recent, still in cache).
+  - Jobs submitted by other threads (Eg: main thread) are spread over the
+  workers' deques.
+  - A worker without jobs steals from the front of the other deques, and
+  sleeps if there is nothing to steal.
+
+  JobCounter counts the unfinished jobs that were submitted with it. Wait
+  returns once the counter reaches 0, and runs other jobs while waiting
+  instead of blocking, so it can be called from jobs too. Work that does not
+  depend on the jobs can be done between Run and Wait.
+
+  ParallelFor splits [0, count) into ranges of grain elements (See
+  CACHE_CHUNK_SIZE) and calls func(begin, end) for each range as a job.
+
+  Usage:
+  JobCounter counter{};
+  jobs.Run([]() { ... }, &counter);
+  jobs.ParallelFor(entities.size(), 256, [&](std::size_t begin, std::size_t end) { ... }, counter);
+  ... // Independent work
+  jobs.Wait(counter);
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <condition_variable>
+
+namespace Engine
+{
+	// Number of unfinished jobs, must outlive the jobs submitted with it
+	struct JobCounter
+	{
+		std::atomic<std::size_t> count{ 0 };
+
+		bool IsDone() const { return count.load(std::memory_order_acquire) == 0; }
+	};
+
+
+	class JobSystem
+	{
+	public:
+		using Job = std::function<void()>;
+
+		// Bytes of data per ParallelFor range (Fits in L1 cache)
+		static constexpr std::size_t CACHE_CHUNK_SIZE = 16 * 1024;
+
+		explicit JobSystem(std::size_t threadCount = DefaultThreadCount());
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		// Queues job, counter (Optional) is decremented once it is done
+		void Run(Job job, JobCounter* counter = nullptr);
+
+		// Runs other jobs until counter reaches 0
+		void Wait(const JobCounter& counter);
+
+		// Runs a single queued job if there is one, returns whether a job was run
+		bool TryRunJob();
+
+		// Calls func(begin, end) for ranges of grain elements in [0, count) as jobs
+		template <typename Func>
+		void ParallelFor(std::size_t count, std::size_t grain, Func func, JobCounter& counter);
+
+		// Same as above but waits for all ranges to be done
+		template <typename Func>
+		void ParallelFor(std::size_t count, std::size_t grain, Func func);
+
+		// Number of elements of T per ParallelFor range so a range is CACHE_CHUNK_SIZE bytes
+		template <typename T>
+		static constexpr std::size_t GrainSize();
+
+		std::size_t GetThreadCount() const;
+
+		// 1 + worker index if called by a worker, else 0 (Eg: main thread)
+		std::size_t GetThreadIndex() const;
+
+		// Number of hardware threads - 1 (At least 1)
+		static std::size_t DefaultThreadCount();
+
+	private:
+		struct Task
+		{
+			Job job{};
+			JobCounter* counter = nullptr;
+		};
+
+		struct Worker
+		{
+			std::deque<Task> tasks{};
+			std::mutex mutex{};
+		};
+
+		void WorkerLoop(std::size_t index);
+
+		// Takes from the back of worker index's deque (If any), else the front of the others
+		bool TryGetTask(std::size_t index, Task& task);
+		void Execute(Task& task);
+
+		std::vector<std::unique_ptr<Worker>> mWorkers{};
+		std::vector<std::thread> mThreads{};
+
+		// Next worker to receive a job from a non-worker thread
+		std::atomic<std::size_t> mNextWorker{ 0 };
+
+		// Queued jobs not taken yet, workers sleep while 0
+		std::atomic<std::size_t> mPending{ 0 };
+		std::mutex mSleepMutex{};
+		std::condition_variable mSleepCondition{};
+		bool mStopping = false;
+	};
+
+
+	// Templated class functions implementations
+
+	template <typename Func>
+	void JobSystem::ParallelFor(std::size_t count, std::size_t grain, Func func, JobCounter& counter)
+	{
+		grain = (std::max)(grain, std::size_t{ 1 });
+
+		for (std::size_t begin = 0; begin < count; begin += grain)
+		{
+			const std::size_t end = (std::min)(begin + grain, count);
+			Run([func, begin, end]() { func(begin, end); }, &counter);
+		}
+	}
+
+
+	template <typename Func>
+	void JobSystem::ParallelFor(std::size_t count, std::size_t grain, Func func)
+	{
+		// Single range, not worth queueing
+		if (count <= grain)
+		{
+			if (count)
+			{
+				func(std::size_t{ 0 }, count);
+			}
+			return;
+		}
+
+		JobCounter counter{};
+		ParallelFor(count, grain, func, counter);
+		Wait(counter);
+	}
+
+
+	template <typename T>
+	constexpr std::size_t JobSystem::GrainSize()
+	{
+		return (std::max)(CACHE_CHUNK_SIZE / sizeof(T), std::size_t{ 1 });
+	}
+
+} // end of namespace
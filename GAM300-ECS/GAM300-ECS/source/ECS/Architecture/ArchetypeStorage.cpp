@@ -0,0 +1,286 @@
+/******************************************************************************/
+/*!
+\file       ArchetypeStorage.cpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the implementation of Archetype and ArchetypeStorage class.
+
+  Entities with the same Signature are stored in the same Archetype, in 16 KB
+  chunks where each component type has its own column.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#include "include/ECS/Architecture/ArchetypeStorage.hpp"
+
+#include <algorithm>
+
+namespace Engine
+{
+	// Round offset up to the next multiple of alignment
+	static std::size_t AlignOffset(std::size_t offset, std::size_t alignment)
+	{
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+
+	EntityID* Archetype::GetEntities(Chunk& chunk)
+	{
+		// Entity IDs are always the first column
+		return reinterpret_cast<EntityID*>(chunk.memory);
+	}
+
+
+	void* Archetype::GetComponent(Chunk& chunk, ComponentType type, std::size_t size, std::uint32_t row)
+	{
+		return chunk.memory + columnOffsets[type] + size * row;
+	}
+
+
+	ArchetypeStorage::ArchetypeStorage(Allocator* allocator_) : mAllocator{ allocator_ }
+	{
+	}
+
+
+	bool ArchetypeStorage::RemoveComponent(EntityID e, ComponentType type)
+	{
+		if (!HasComponent(e, type))
+		{
+			LOG_WARNING("Removing non-existent component.");
+			return false;
+		}
+
+		// Removed component is destroyed together with the old row
+		MoveEntity(e, GetTransition(mLocations[e].archetype, type, false));
+		return true;
+	}
+
+
+	bool ArchetypeStorage::HasComponent(EntityID e, ComponentType type) const
+	{
+		if (e >= mLocations.Size() || mLocations[e].archetype == nullptr)
+		{
+			return false;
+		}
+
+		return mLocations[e].archetype->signature.test(type);
+	}
+
+
+	void ArchetypeStorage::DestroyEntity(EntityID e)
+	{
+		if (e >= mLocations.Size() || mLocations[e].archetype == nullptr)
+		{
+			return;
+		}
+
+		EntityLocation location = mLocations[e];
+		RemoveRow(location.archetype, location.chunk, location.row);
+		mLocations[e] = EntityLocation{};
+	}
+
+
+	void ArchetypeStorage::Free()
+	{
+		for (auto& [signature, archetype] : mArchetypes)
+		{
+			for (Archetype::Chunk& chunk : archetype->chunks)
+			{
+				for (ComponentType type : archetype->types)
+				{
+					const ComponentInfo& info = mComponentInfos[type];
+					for (std::uint32_t row = 0; row < chunk.count; ++row)
+					{
+						info.Destroy(archetype->GetComponent(chunk, type, info.size, row));
+					}
+				}
+				mAllocator->Free(chunk.memory);
+			}
+			archetype->chunks.clear();
+		}
+		mArchetypes.clear();
+
+		mLocations.Clear();
+	}
+
+
+	Archetype* ArchetypeStorage::GetArchetype(const Signature& signature)
+	{
+		// Entities without any component are not stored
+		if (signature.none())
+		{
+			return nullptr;
+		}
+
+		auto itr = mArchetypes.find(signature);
+		if (itr != mArchetypes.end())
+		{
+			return itr->second.get();
+		}
+
+		auto archetype = std::make_unique<Archetype>();
+		archetype->signature = signature;
+		archetype->columnOffsets.fill(-1);
+
+		std::size_t rowSize = sizeof(EntityID);
+		for (std::size_t type = 0; type < MAX_COMPONENTS; ++type)
+		{
+			if (signature.test(type))
+			{
+				LOG_ASSERT(mComponentInfos[type].size != 0 && "Component not registered.");
+
+				archetype->types.emplace_back(static_cast<ComponentType>(type));
+				rowSize += mComponentInfos[type].size;
+			}
+		}
+
+		// Fit as many rows as possible in a chunk (At least 1 row for huge components)
+		auto layout = [&](std::uint32_t rows)
+		{
+			std::size_t offset = sizeof(EntityID) * rows;
+			for (ComponentType type : archetype->types)
+			{
+				const ComponentInfo& info = mComponentInfos[type];
+				offset = AlignOffset(offset, info.alignment);
+				archetype->columnOffsets[type] = static_cast<std::int32_t>(offset);
+				offset += info.size * rows;
+			}
+			return offset;
+		};
+
+		std::uint32_t rows = static_cast<std::uint32_t>((std::max)(std::size_t{ 1 }, ARCHETYPE_CHUNK_SIZE / rowSize));
+		std::size_t size = layout(rows);
+		while (size > ARCHETYPE_CHUNK_SIZE && rows > 1)
+		{
+			size = layout(--rows);
+		}
+
+		archetype->rowsPerChunk = rows;
+		archetype->chunkSize = (std::max)(size, ARCHETYPE_CHUNK_SIZE);
+
+		Archetype* ptr = archetype.get();
+		mArchetypes.insert({ signature, std::move(archetype) });
+		return ptr;
+	}
+
+
+	Archetype* ArchetypeStorage::GetTransition(Archetype* from, ComponentType type, bool add)
+	{
+		if (from == nullptr)
+		{
+			Signature signature{};
+			signature.set(type, add);
+			return GetArchetype(signature);
+		}
+
+		std::array<Archetype*, MAX_COMPONENTS>& edges = add ? from->addEdges : from->removeEdges;
+		if (edges[type] == nullptr)
+		{
+			Signature signature = from->signature;
+			signature.set(type, add);
+			edges[type] = GetArchetype(signature);
+		}
+
+		return edges[type];
+	}
+
+
+	void ArchetypeStorage::MoveEntity(EntityID e, Archetype* dst)
+	{
+		EntityLocation src = mLocations[e];
+		EntityLocation location{};
+
+		if (dst)
+		{
+			location.archetype = dst;
+			AllocateRow(dst, e, location.chunk, location.row);
+
+			// Move components that exist in both archetypes
+			if (src.archetype)
+			{
+				Archetype::Chunk& srcChunk = src.archetype->chunks[src.chunk];
+				Archetype::Chunk& dstChunk = dst->chunks[location.chunk];
+
+				for (ComponentType type : src.archetype->types)
+				{
+					if (dst->signature.test(type))
+					{
+						const ComponentInfo& info = mComponentInfos[type];
+						info.MoveConstruct(dst->GetComponent(dstChunk, type, info.size, location.row),
+							src.archetype->GetComponent(srcChunk, type, info.size, src.row));
+					}
+				}
+			}
+		}
+
+		if (src.archetype)
+		{
+			RemoveRow(src.archetype, src.chunk, src.row);
+		}
+
+		mLocations[e] = location;
+	}
+
+
+	void ArchetypeStorage::AllocateRow(Archetype* archetype, EntityID e, std::uint32_t& chunk, std::uint32_t& row)
+	{
+		if (archetype->chunks.empty() || archetype->chunks.back().count == archetype->rowsPerChunk)
+		{
+			Archetype::Chunk newChunk{};
+			newChunk.memory = reinterpret_cast<std::byte*>(mAllocator->Allocate(archetype->chunkSize, 16));
+			archetype->chunks.emplace_back(newChunk);
+		}
+
+		chunk = static_cast<std::uint32_t>(archetype->chunks.size() - 1);
+		Archetype::Chunk& last = archetype->chunks.back();
+		row = last.count++;
+
+		archetype->GetEntities(last)[row] = e;
+	}
+
+
+	void ArchetypeStorage::RemoveRow(Archetype* archetype, std::uint32_t chunk, std::uint32_t row)
+	{
+		Archetype::Chunk& hole = archetype->chunks[chunk];
+		Archetype::Chunk& last = archetype->chunks.back();
+		const std::uint32_t lastRow = last.count - 1;
+
+		for (ComponentType type : archetype->types)
+		{
+			const ComponentInfo& info = mComponentInfos[type];
+			info.Destroy(archetype->GetComponent(hole, type, info.size, row));
+		}
+
+		// Move last row into the hole to keep rows packed
+		if (&hole != &last || row != lastRow)
+		{
+			for (ComponentType type : archetype->types)
+			{
+				const ComponentInfo& info = mComponentInfos[type];
+				void* lastComponent = archetype->GetComponent(last, type, info.size, lastRow);
+
+				info.MoveConstruct(archetype->GetComponent(hole, type, info.size, row), lastComponent);
+				info.Destroy(lastComponent);
+			}
+
+			EntityID moved = archetype->GetEntities(last)[lastRow];
+			archetype->GetEntities(hole)[row] = moved;
+			mLocations[moved].chunk = chunk;
+			mLocations[moved].row = row;
+		}
+
+		// Release chunk once it is empty
+		if (--last.count == 0)
+		{
+			mAllocator->Free(last.memory);
+			archetype->chunks.pop_back();
+		}
+	}
+
+} // end of namespace
@@ -28,37 +28,304 @@
 
 namespace Engine
 {
+	ComponentManager::ComponentManager(StorageMode mode) : mStorageMode{ mode } {}
+
+
 	void ComponentManager::DestroyEntity(Entity& e)
 	{
+		EntityID id = e.GetEntityID();
+		DestroyEntity(id);
+	}
+
+
+	void ComponentManager::DestroyEntity(EntityID& e)
+	{
+		QueueDestroyEvents(e);
+
+		if (mArchetypeStorage)
+		{
+			mArchetypeStorage->DestroyEntity(e);
+		}
+
 		// Notify each component array that an entity has been destroyed
 		// If it has a component for that entity, it will remove it
-		for (auto const& pair : mComponentArrays)
+		for (auto const& component : mComponents)
 		{
-			auto const& component = pair.second;
-
-			component->EntityDestroyed(e);
+			if (component.array)
+			{
+				component.array->EntityDestroyed(e);
+			}
 		}
 	}
 
 
-	void ComponentManager::DestroyEntity(EntityID& e)
+	void ComponentManager::DestroyEntities(std::span<const EntityID> entities)
 	{
-		// Notify each component array that an entity has been destroyed
-		// If it has a component for that entity, it will remove it
-		for (auto const& pair : mComponentArrays)
+		for (EntityID e : entities)
 		{
-			auto const& component = pair.second;
+			QueueDestroyEvents(e);
+		}
 
-			component->EntityDestroyed(e);
+		if (mArchetypeStorage)
+		{
+			for (EntityID e : entities)
+			{
+				mArchetypeStorage->DestroyEntity(e);
+			}
+		}
+
+		for (auto const& component : mComponents)
+		{
+			if (component.array)
+			{
+				component.array->EntitiesDestroyed(entities);
+			}
 		}
 	}
 
 
 	void ComponentManager::FreeCustomAllocator()
 	{
-		for (auto const& pair : mComponentArrays)
+		if (mArchetypeStorage)
+		{
+			mArchetypeStorage->Free();
+		}
+
+		for (auto const& component : mComponents)
+		{
+			if (component.array)
+			{
+				component.array->FreeComponentArray();
+			}
+		}
+	}
+
+
+	std::size_t ComponentManager::ReleaseEmptyPages()
+	{
+		std::size_t released = 0;
+		for (auto const& component : mComponents)
+		{
+			if (component.array)
+			{
+				released += component.array->ReleaseEmptyPages();
+			}
+		}
+		return released;
+	}
+
+
+	bool ComponentManager::Snapshot(ComponentSnapshot& snapshot) const
+	{
+		LOG_ASSERT(mStorageMode == StorageMode::Pool && "Snapshots are only supported by StorageMode::Pool.");
+		if (mStorageMode != StorageMode::Pool)
+		{
+			LOG_WARNING("Snapshots are only supported by StorageMode::Pool.");
+			return false;
+		}
+
+		snapshot.arrays.resize(mComponents.size());
+		for (std::size_t id = 0; id < mComponents.size(); ++id)
+		{
+			if (!mComponents[id].array)
+			{
+				snapshot.arrays[id].reset();
+			}
+			else if (!mComponents[id].array->Snapshot(snapshot.arrays[id]))
+			{
+				// Not copyable, restoring would strip the component from entities that still have it
+				return false;
+			}
+		}
+		return true;
+	}
+
+
+	bool ComponentManager::Restore(const ComponentSnapshot& snapshot)
+	{
+		LOG_ASSERT(mStorageMode == StorageMode::Pool && "Snapshots are only supported by StorageMode::Pool.");
+		if (mStorageMode != StorageMode::Pool)
+		{
+			LOG_WARNING("Snapshots are only supported by StorageMode::Pool.");
+			return false;
+		}
+
+		// Pages of every array are allocated first, so failing leaves all components as they are
+		for (std::size_t id = 0; id < mComponents.size() && id < snapshot.arrays.size(); ++id)
+		{
+			if (mComponents[id].array && snapshot.arrays[id] && !mComponents[id].array->PrepareRestore(*snapshot.arrays[id]))
+			{
+				LOG_WARNING("Not enough memory to restore snapshot.");
+				return false;
+			}
+		}
+
+		// Events of the replaced components no longer apply
+		ClearEvents();
+
+		bool restored = true;
+		const Tick tick = GetChangeTick();
+		for (std::size_t id = 0; id < mComponents.size(); ++id)
+		{
+			RegisteredComponent& component = mComponents[id];
+			if (!component.array)
+			{
+				continue;
+			}
+
+			// Registered after the snapshot was taken
+			if (id >= snapshot.arrays.size() || !snapshot.arrays[id])
+			{
+				component.array->FreeComponentArray();
+				continue;
+			}
+
+			const ComponentArraySnapshot& array = *snapshot.arrays[id];
+			if (!component.array->Restore(array))
+			{
+				restored = false;
+				continue;
+			}
+
+			for (EntityID e : array.entities)
+			{
+				component.versions.Resize(static_cast<std::size_t>(e) + 1);
+				component.versions[e] = tick;
+			}
+		}
+		return restored;
+	}
+
+
+	bool ComponentManager::SortStep(std::size_t maxSteps)
+	{
+		bool sorted = true;
+		for (auto const& component : mComponents)
+		{
+			if (component.array)
+			{
+				sorted = component.array->SortStep(maxSteps) && sorted;
+			}
+		}
+		return sorted;
+	}
+
+
+	StorageMode ComponentManager::GetStorageMode() const
+	{
+		return mStorageMode;
+	}
+
+
+	Tick ComponentManager::GetChangeTick() const
+	{
+		return mChangeTick.load(std::memory_order_relaxed);
+	}
+
+
+	Tick ComponentManager::AdvanceChangeTick()
+	{
+		return mChangeTick.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+
+
+
+	void ComponentManager::DispatchEvents()
+	{
+		mDispatching = true;
+
+		// Observers may register components, so mComponents is indexed every iteration
+		for (std::size_t id = 0; id < mComponents.size(); ++id)
+		{
+			ComponentObservers* component = mComponents[id].observers.get();
+			if (!component)
+			{
+				continue;
+			}
+
+			// Events queued by observers during dispatch are left for the next call
+			std::size_t pending = component->events.Size();
+			while (pending > 0)
+			{
+				const ComponentEvent event = component->events.Front().event;
+
+				mEventBatch.clear();
+				while (pending > 0 && component->events.Front().event == event)
+				{
+					mEventBatch.emplace_back(component->events.Front().entity);
+					component->events.Pop();
+					--pending;
+				}
+
+				for (ComponentObserver& observer : component->observers[static_cast<std::size_t>(event)])
+				{
+					observer(mEventBatch);
+				}
+			}
+		}
+
+		mDispatching = false;
+		for (PendingObserver& pending : mPendingObservers)
 		{
-			pair.second->FreeComponentArray();
+			AddObserver(pending.id, pending.event, std::move(pending.observer));
+		}
+		mPendingObservers.clear();
+	}
+
+
+	void ComponentManager::ClearEvents()
+	{
+		for (auto const& component : mComponents)
+		{
+			if (component.observers)
+			{
+				component.observers->events.Clear();
+			}
+		}
+	}
+
+
+	void ComponentManager::AddObserver(std::size_t id, ComponentEvent event, ComponentObserver observer)
+	{
+		RegisteredComponent& component = mComponents[id];
+		if (!component.observers)
+		{
+			component.observers = std::make_unique<ComponentObservers>();
+		}
+		component.observers->observers[static_cast<std::size_t>(event)].emplace_back(std::move(observer));
+	}
+
+
+	void ComponentManager::QueueEvent(std::size_t id, ComponentEvent event, EntityID e)
+	{
+		if (id >= mComponents.size() || !mComponents[id].observers)
+		{
+			return;
+		}
+
+		ComponentObservers& component = *mComponents[id].observers;
+		if (!component.observers[static_cast<std::size_t>(event)].empty())
+		{
+			component.events.Push(QueuedEvent{ e, event });
+		}
+	}
+
+
+	void ComponentManager::QueueDestroyEvents(EntityID e)
+	{
+		for (std::size_t id = 0; id < mComponents.size(); ++id)
+		{
+			const RegisteredComponent& component = mComponents[id];
+			if (!component.observers || component.observers->observers[static_cast<std::size_t>(ComponentEvent::Remove)].empty())
+			{
+				continue;
+			}
+
+			const bool hasComponent = component.array ? component.array->Contains(e) : mArchetypeStorage->HasComponent(e, component.type);
+			if (hasComponent)
+			{
+				QueueEvent(id, ComponentEvent::Remove, e);
+			}
 		}
 	}
 
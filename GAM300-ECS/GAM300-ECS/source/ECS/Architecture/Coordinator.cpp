@@ -20,6 +20,7 @@
 #pragma once
 
 #include "include/ECS/Architecture/Coordinator.hpp"
+#include "include/ECS/Architecture/WorldSnapshot.hpp"
 #include "include/Memory/FreeListAllocator.hpp"
 
 #include "include/ECS/Component/Transform.hpp"
@@ -27,6 +28,7 @@
 #include "include/ECS/System/ParticleSystem.hpp"
 
 #include <memory>
+#include <algorithm>
 
 
 #define DUPLICATE_COMPONENTS(d, o)	DUPLICATE_COMPONENT(Transform, d, o)\
@@ -49,13 +51,16 @@ namespace Engine
 	};
 
 
-	void Coordinator::Init()
+	void Coordinator::Init(StorageMode mode)
 	{
 		mFreeListAllocator = new FreeListAllocator((size_t)1e8);
 
 		mEntityManager = std::make_unique<EntityManager>();
-		mComponentManager = std::make_unique<ComponentManager>();
+		mComponentManager = std::make_unique<ComponentManager>(mode);
 		mSystemManager = std::make_unique<SystemManager>();
+		mQueryManager = std::make_unique<QueryManager>();
+		mJobSystem = std::make_unique<JobSystem>();
+		mCommandBuffers.resize(mJobSystem->GetThreadCount() + 1);
 
 		RegisterComponents();
 		RegisterSystems();
@@ -72,8 +77,19 @@ namespace Engine
 			mSystemManager->DestroyEntity(e);
 		}
 		mEntities.clear();
-		mParentChild.clear();
+		mEntityIndex.Clear();
+		mEntityNames.clear();
+		mNameSuffixes.clear();
+		mHierarchy.Clear();
+		mEffectiveActive.Clear();
 		mPrefabReloading.clear();
+		mTimedDestroys = {};
+		mQueryManager->Clear();
+		mComponentManager->ClearEvents();
+		for (EntityCommandBuffer& buffer : mCommandBuffers)
+		{
+			buffer.Clear();
+		}
 
 		mComponentManager->FreeCustomAllocator();
 
@@ -84,10 +100,10 @@ namespace Engine
 	void Coordinator::RegisterComponents()
 	{
 		// Register ALL components here
-		RegisterComponent<Transform, MAX_ENTITIES>();
-		RegisterComponent<Particle, MAX_ENTITIES>();
+		RegisterComponent<Transform>();
+		RegisterComponent<Particle>();
 
-		//RegisterComponent<std::vector<Transform>, MAX_ENTITIES>();
+		//RegisterComponent<std::vector<Transform>>();
 	}
 
 
@@ -96,9 +112,178 @@ namespace Engine
 		// Register ALL systems and their respective signature here
 		RegisterSystem<TransformSystem>();
 		AssignSystemSignature<TransformSystem, Transform>(Transform{});
+		AssignSystemAccess<TransformSystem>(Read<>{}, Write<Transform>{});
+		PrepareQuery<Transform>();
 
+		// Makes OpenGL calls
 		RegisterSystem<ParticleSystem>();
 		AssignSystemSignature<ParticleSystem, Particle>(Particle{});
+		AssignSystemAccess<ParticleSystem>(Read<>{}, Write<Particle>{}, true);
+	}
+
+
+	void Coordinator::UpdateSystems(float deltaTime)
+	{
+		// Hierarchy changes stamped up to now are seen by every system this update
+		const Tick tick = GetChangeTick();
+		mSystemManager->UpdateSystems(this, deltaTime, *mJobSystem);
+		mHierarchy.TrimChanges(tick);
+
+		// Changes from playback and outside of systems are newer than every system's last run
+		AdvanceChangeTick();
+
+		ProcessTimedDestroys(deltaTime);
+		PlaybackCommands();
+
+		// Continue relocating components being sorted (No system is iterating them)
+		mComponentManager->SortStep(SORT_STEPS_PER_UPDATE);
+
+		// Structural changes of this frame are done
+		DispatchComponentEvents();
+	}
+
+
+	void Coordinator::DispatchComponentEvents()
+	{
+		mComponentManager->DispatchEvents();
+	}
+
+
+	Tick Coordinator::GetChangeTick() const
+	{
+		return mComponentManager->GetChangeTick();
+	}
+
+
+	Tick Coordinator::AdvanceChangeTick()
+	{
+		return mComponentManager->AdvanceChangeTick();
+	}
+
+
+	JobSystem& Coordinator::GetJobSystem()
+	{
+		return *mJobSystem;
+	}
+
+
+	EntityCommandBuffer& Coordinator::GetCommandBuffer()
+	{
+		return mCommandBuffers[mJobSystem->GetThreadIndex()];
+	}
+
+
+	void Coordinator::PlaybackCommands()
+	{
+		using Command = EntityCommandBuffer::Command;
+		using CommandType = EntityCommandBuffer::CommandType;
+
+		struct Change
+		{
+			EntityID entity;
+			const Command* command;
+		};
+
+		std::vector<Change> changes{};
+		std::vector<EntityID> destroyed{};
+
+		for (EntityCommandBuffer& buffer : mCommandBuffers)
+		{
+			if (buffer.Empty())
+			{
+				continue;
+			}
+
+			// Create entities first so deferred IDs can be resolved
+			std::vector<EntityID> created{};
+			for (const Command& command : buffer.GetCommands())
+			{
+				if (command.type == CommandType::CreateEntity)
+				{
+					created.emplace_back(CreateEntity(buffer.GetCreatedName(created.size())));
+				}
+			}
+
+			for (const Command& command : buffer.GetCommands())
+			{
+				EntityID e = command.entity;
+				if (EntityCommandBuffer::IsDeferred(e))
+				{
+					// Deferred IDs are only valid in the buffer that created them (Same thread)
+					const std::size_t index = e & ~EntityCommandBuffer::DEFERRED_ENTITY_BIT;
+					LOG_ASSERT(index < created.size() && "Deferred entity recorded into another thread's command buffer.");
+					if (index >= created.size())
+					{
+						continue;
+					}
+					e = created[index];
+				}
+
+				if (command.type == CommandType::DestroyEntity)
+				{
+					destroyed.emplace_back(e);
+				}
+				else if (command.type != CommandType::CreateEntity)
+				{
+					changes.emplace_back(Change{ e, &command });
+				}
+			}
+		}
+
+		// Group changes by entity, keeping the recorded order of each entity's changes
+		std::stable_sort(changes.begin(), changes.end(), [](const Change& lhs, const Change& rhs) { return lhs.entity < rhs.entity; });
+		std::sort(destroyed.begin(), destroyed.end());
+
+		for (std::size_t first = 0, last = 0; first < changes.size(); first = last)
+		{
+			EntityID e = changes[first].entity;
+			while (last < changes.size() && changes[last].entity == e)
+			{
+				++last;
+			}
+
+			if (!EntityExists(e) || std::binary_search(destroyed.begin(), destroyed.end(), e))
+			{
+				continue;
+			}
+
+			const Signature before = mEntityManager->GetSignature(e);
+			Signature after = before;
+			for (std::size_t i = first; i < last; ++i)
+			{
+				const Command& command = *changes[i].command;
+				const ComponentType type = command.ops->getType(*mComponentManager);
+
+				if (command.type == CommandType::AddComponent)
+				{
+					if (command.ops->add(*mComponentManager, e, command.component))
+					{
+						after.set(type);
+					}
+				}
+				else if (after.test(type))
+				{
+					command.ops->remove(*mComponentManager, e);
+					after.reset(type);
+				}
+			}
+
+			// Systems and queries are only updated once per entity
+			if (after != before)
+			{
+				mEntityManager->SetSignature(e, after);
+				mSystemManager->EntitySignatureChanged(e, after, before ^ after);
+				mQueryManager->EntitySignatureChanged(e, after);
+			}
+		}
+
+		// Children of destroyed entities are destroyed with them
+		DestroyEntities(destroyed);
+
+		for (EntityCommandBuffer& buffer : mCommandBuffers)
+		{
+			buffer.Clear();
+		}
 	}
 
 
@@ -106,14 +291,12 @@ namespace Engine
 	{
 		Entity e = mEntityManager->CreateEntity(__name__);
 
-		int i = 1;
-		std::string name = e.GetEntityName();
-		while (IsNameRepeated(e))
+		if (IsNameRepeated(e))
 		{
-			e.SetEntityName(name + " (" + std::to_string(i++) + ")");
+			e.SetEntityName(GetUniqueName(e.GetEntityName() + " ("));
 		}
 
-		mEntities.emplace_back(e);
+		AddEntity(e);
 
 		return e.GetEntityID();
 	}
@@ -122,47 +305,29 @@ namespace Engine
 	void Coordinator::DuplicateEntity(Entity entity, EntityID parentID)
 	{
 		// Create new entity based on parentID (As a standalone or as a child)
-		EntityID duplicated_id = entity.GetParent() < MAX_ENTITIES ? CreateChild(parentID) : CreateEntity();
+		EntityID duplicated_id = entity.GetParent() != INVALID_ENTITY ? CreateChild(parentID) : CreateEntity();
 		Entity& duplicated_entity = *GetEntity(duplicated_id);
 
 		// Duplicate entity (Copy all variables + Components) based on original except name
 		duplicated_entity.Copy(entity);
-		if (std::string prefabName = duplicated_entity.GetPrefab(); prefabName != "")
+		RefreshActive(duplicated_id);
+		if (!duplicated_entity.GetPrefabView().empty())
 		{
-			AddToPrefabMap(prefabName, duplicated_id);
+			AddToPrefabMap(duplicated_entity.GetPrefab(), duplicated_id);
 		}
-		duplicated_entity.SetKeyTag(entity.GetKeyTag());
 		Tag tag = GetTag(entity);
 		SetTag(duplicated_entity, tag);
 
 		// Getting a unique name based on prefab's entity name
-		std::string entity_name = entity.GetEntityName();
-		std::string duplicate_name{};
-
-		int i = 1;
-		for (int size = 0; size < mEntities.size(); ++size)
-		{
-			duplicate_name = entity_name + "(" + std::to_string(i) + ")";
-
-			if (mEntities[size].GetEntityName() == duplicate_name)
-			{
-				// Increament till highest value, reset back loop to check again.
-				++i;
-				size = 0;
-			}
-		}
-		duplicated_entity.SetEntityName(duplicate_name);
+		SetEntityName(duplicated_id, GetUniqueName(entity.GetEntityName() + "("));
 
 		// Duplicate components
 		DUPLICATE_COMPONENTS(duplicated_entity, entity)
 
 		// Loop original entity children
-		if (mParentChild.find(entity.GetEntityID()) != mParentChild.end())
+		for (EntityID child = mHierarchy.GetFirstChild(entity.GetEntityID()); child != INVALID_ENTITY; child = mHierarchy.GetNextSibling(child))
 		{
-			for (auto& child : mParentChild[entity.GetEntityID()])
-			{
-				DuplicateEntity(*GetEntity(child), duplicated_id);
-			}
+			DuplicateEntity(*GetEntity(child), duplicated_id);
 		}
 	}
 
@@ -172,8 +337,9 @@ namespace Engine
 		(*GetEntity(parent)).SetIs_Parent(true);
 
 		Entity e = mEntityManager->CreateChild(parent, __name__);
-		mEntities.emplace_back(e); //insert this
-		mParentChild[parent].emplace_back(e.GetEntityID());
+		AddEntity(e);
+		mHierarchy.Attach(parent, e.GetEntityID(), GetChangeTick());
+		RefreshActive(e.GetEntityID());
 
 		return e.GetEntityID();
 	}
@@ -181,29 +347,24 @@ namespace Engine
 
 	void Coordinator::ToChild(EntityID parent, EntityID child)
 	{
-		Entity& e = *GetEntity(child);
-		(*GetEntity(parent)).SetIs_Parent(true);
-
-		if (e.IsChild())
+		// Hierarchy is checked for the current parent, as the Entity's parent ID may be an index (Serializer)
+		const EntityID previous = mHierarchy.GetParent(child);
+		if (!mHierarchy.Attach(parent, child, GetChangeTick()))
 		{
-			// Remove child from the vector in mParentChild
-			std::vector<EntityID>& childs = mParentChild[e.GetParent()];
-			childs.erase(std::find(childs.begin(), childs.end(), child));
-
-			if (mParentChild[e.GetParent()].size() == 0)
-			{
-				GetEntity(e.GetParent())->SetIs_Parent(false);
-				mParentChild.erase(e.GetParent());
-			}
+			return;
 		}
-		else
+
+		if (previous != INVALID_ENTITY && mHierarchy.GetFirstChild(previous) == INVALID_ENTITY)
 		{
-			e.SetIs_Child(true);
+			GetEntity(previous)->SetIs_Parent(false);
 		}
+		GetEntity(parent)->SetIs_Parent(true);
+
+		Entity& e = *GetEntity(child);
+		e.SetIs_Child(true);
 		e.SetParentID(parent);
 
-		// Add child to mParentChild
-		mParentChild[parent].emplace_back(child);
+		RefreshActive(child);
 	}
 
 
@@ -211,69 +372,78 @@ namespace Engine
 	{
 		Entity* entity_child = GetEntity(child);
 		entity_child->SetIs_Child(false);
-		entity_child->SetParentID(MAX_ENTITIES + 1);
+		entity_child->SetParentID(INVALID_ENTITY);
 
-		std::vector<EntityID>& children = mParentChild[parent];
-		auto itr = std::find(children.begin(), children.end(), child);
-		if (itr != children.end())
+		if (mHierarchy.GetParent(child) == parent)
 		{
-			mParentChild[parent].erase(itr);
+			mHierarchy.Detach(child, GetChangeTick());
+			RefreshActive(child);
 		}
 
-		// If there is no more children, get rid of parent ID in map
-		if (mParentChild[parent].size() == 0)
+		// If there is no more children, parent is no longer a parent
+		if (mHierarchy.Contains(parent) && mHierarchy.GetFirstChild(parent) == INVALID_ENTITY)
 		{
 			Entity* entity_parent = GetEntity(parent);
 			if (entity_parent)
 			{
 				entity_parent->SetIs_Parent(false);
 			}
-			mParentChild.erase(parent);
 		}
 	}
 
 
 	std::vector<EntityID> Coordinator::GetChildObjects(EntityID id)
 	{
-		auto it = mParentChild.find(id);
-		if (it != mParentChild.end())
+		std::vector<EntityID> children{};
+		if (!mHierarchy.Contains(id))
 		{
-			return mParentChild[id];
+			return children;
 		}
-		// Else return empty vector
-		return std::vector<EntityID>();
+
+		for (EntityID child = mHierarchy.GetFirstChild(id); child != INVALID_ENTITY; child = mHierarchy.GetNextSibling(child))
+		{
+			children.emplace_back(child);
+		}
+		return children;
 	}
 
 
 	Entity* Coordinator::GetChildObject(EntityID parent, uint32_t index)
 	{
-		auto children = GetChildObjects(parent);
-		LOG_ASSERT(!children.empty() && "Calling GetChildObject on entity without a child!");
+		EntityID child = mHierarchy.GetFirstChild(parent);
+		LOG_ASSERT(child != INVALID_ENTITY && "Calling GetChildObject on entity without a child!");
+
+		for (; index > 0 && child != INVALID_ENTITY; --index)
+		{
+			child = mHierarchy.GetNextSibling(child);
+		}
 
-		return GetEntity(children[index]);
+		return GetEntity(child);
 	}
 
 
 	void Coordinator::GetAllChildren(std::vector<EntityID>& container, EntityID id)
 	{
-		container.emplace_back(id);
-
-		for (auto& i : GetChildObjects(id))
+		if (!mHierarchy.Contains(id))
 		{
-			GetAllChildren(container, i);
+			return;
 		}
+
+		// Subtree is contiguous in the hierarchy's order
+		std::span<const EntityID> subtree = mHierarchy.GetSubtree(id);
+		container.insert(container.end(), subtree.begin(), subtree.end());
 	}
 
 
-	std::vector<Entity>& Coordinator::GetEntities()
+	const Hierarchy& Coordinator::GetHierarchy() const
 	{
-		return mEntities;
+		return mHierarchy;
 	}
 
 
-	std::map<EntityID, std::vector<EntityID>>& Coordinator::GetMap()
+	std::vector<Entity>& Coordinator::GetEntities()
 	{
-		return mParentChild;
+		return mEntities;
 	}
 
 
@@ -315,19 +485,10 @@ namespace Engine
 	{
 		std::vector<EntityID>& value = mPrefabReloading[prefabName];
 
-		int index = MAX_ENTITIES + 1;
-		for (int i = 0; i < value.size(); ++i)
-		{
-			if (id == value[i])
-			{
-				index = i;
-				break;
-			}
-		}
-
-		if (index < MAX_ENTITIES)
+		auto itr = std::find(value.begin(), value.end(), id);
+		if (itr != value.end())
 		{
-			value.erase(value.begin() + index);
+			value.erase(itr);
 		}
 	}
 
@@ -340,157 +501,310 @@ namespace Engine
 
 	void Coordinator::DestroyEntity(EntityID e)
 	{
-		// Recursive, DFS to first child
-		for (auto& child : GetChildObjects(e))
+		DestroyEntities(std::span<const EntityID>(&e, 1));
+	}
+
+
+	void Coordinator::DestroyEntities(std::span<const EntityID> entities)
+	{
+		// Entities and all of their children, sorted without duplicates (Children may be passed in too)
+		std::vector<EntityID> destroyed{};
+		for (EntityID e : entities)
 		{
-			DestroyEntity(child);
+			if (EntityExists(e))
+			{
+				GetAllChildren(destroyed, e);
+			}
 		}
+		std::sort(destroyed.begin(), destroyed.end());
+		destroyed.erase(std::unique(destroyed.begin(), destroyed.end()), destroyed.end());
 
-		Entity& entity = *GetEntity(e);
+		if (destroyed.empty())
+		{
+			return;
+		}
 
-		// If valid prefabName, remove from prefabName-EntityID container
-		std::string prefabName = entity.GetPrefab();
-		RemoveFromPrefabMap(prefabName, e);
+		auto IsDestroyed = [&destroyed](EntityID e)
+		{
+			return std::binary_search(destroyed.begin(), destroyed.end(), e);
+		};
 
-		// If valid parentID, remove from parent-child container
-		EntityID parentID = entity.GetParent();
-		if (parentID < MAX_ENTITIES)
+		// Parents that are not destroyed and prefab containers, each is updated once
+		std::vector<EntityID> parents{};
+		std::vector<std::string> prefabNames{};
+		for (EntityID e : destroyed)
 		{
-			std::vector<EntityID>& children = mParentChild[parentID];
-			auto itr = std::find(children.begin(), children.end(), e);
-			if (itr != children.end())
+			Entity& entity = *GetEntity(e);
+
+			if (!entity.GetPrefabView().empty())
+			{
+				prefabNames.emplace_back(entity.GetPrefab());
+			}
+
+			EntityID parentID = entity.GetParent();
+			if (parentID != INVALID_ENTITY && !IsDestroyed(parentID))
 			{
-				mParentChild[parentID].erase(itr);
+				parents.emplace_back(parentID);
 			}
+		}
+		std::sort(parents.begin(), parents.end());
+		parents.erase(std::unique(parents.begin(), parents.end()), parents.end());
+		std::sort(prefabNames.begin(), prefabNames.end());
+		prefabNames.erase(std::unique(prefabNames.begin(), prefabNames.end()), prefabNames.end());
 
-			// If there is no more children, get rid of parentID in map
-			if (mParentChild[parentID].size() == 0)
+		mHierarchy.Remove(destroyed);
+		for (EntityID parentID : parents)
+		{
+			// If there is no more children, parent is no longer a parent
+			if (mHierarchy.GetFirstChild(parentID) == INVALID_ENTITY)
 			{
-				Entity* entity_parent = GetEntity(parentID);
-				if (entity_parent)
+				if (Entity* entity_parent = GetEntity(parentID))
 				{
 					entity_parent->SetIs_Parent(false);
 				}
-				mParentChild.erase(parentID);
 			}
 		}
 
-		// Remove entity from mEntities container
-		int index = 0;
-		for (int i = 0; i < mEntities.size(); ++i)
+		for (const std::string& prefabName : prefabNames)
 		{
-			if (e == mEntities[i].GetEntityID())
+			auto itr = mPrefabReloading.find(prefabName);
+			if (itr != mPrefabReloading.end())
 			{
-				index = i;
-				break;
+				std::erase_if(itr->second, IsDestroyed);
 			}
 		}
-		mEntities.erase(mEntities.begin() + index);
 
-		mEntityManager->DestroyEntity(e);
-		mComponentManager->DestroyEntity(e);
-		mSystemManager->DestroyEntity(e);
+		for (EntityID e : destroyed)
+		{
+			// Remove entity from mEntities container
+			RemoveEntity(e);
+			mEntityManager->DestroyEntity(e);
+		}
+
+		// Single pass over each component array, system and query
+		mComponentManager->DestroyEntities(destroyed);
+		mSystemManager->DestroyEntities(destroyed);
+		mQueryManager->DestroyEntities(destroyed);
 	}
 
 
 	void Coordinator::DestroyEntity(Entity e, float delay)
 	{
-		v_timed_destroys.emplace_back(std::pair<unsigned int, float>(e.GetEntityID(), delay));
+		DestroyEntity(e.GetEntityID(), delay);
 	}
 
 
-	Entity* Coordinator::GetEntity(EntityID id)
+	void Coordinator::DestroyEntity(EntityID e, float delay)
 	{
-		for (int i = 0; i < mEntities.size(); ++i)
+		if (!EntityExists(e))
 		{
-			if (mEntities[i].GetEntityID() == id)
-			{
-				return &mEntities[i];
-			}
+			LOG_WARNING("Destroying non-existent entity.");
+			return;
 		}
-		return nullptr;
+
+		// Handle becomes stale if the entity is destroyed before the delay, no need to search for it
+		mTimedDestroys.push(TimedDestroy{ mTime + delay, GetHandle(e) });
 	}
 
 
-	Entity* Coordinator::GetEntityByName(std::string name)
+	Entity* Coordinator::GetEntity(EntityID id)
 	{
-		for (int i = 0; i < mEntities.size(); ++i)
+		if (!EntityExists(id))
 		{
-			if (mEntities[i].GetEntityName() == name)
-			{
-				return &mEntities[i];
-			}
+			return nullptr;
 		}
-		return nullptr;
+
+		return &mEntities[mEntityIndex[id]];
 	}
 
 
-	bool Coordinator::IsNameRepeated(std::string name)
+	Entity* Coordinator::GetEntityByName(std::string_view name)
 	{
-		for (int i = 0; i < mEntities.size(); ++i)
+		auto itr = mEntityNames.find(Entity::FindNameKey(name));
+		if (itr == mEntityNames.end())
 		{
-			if (name == mEntities[i].GetEntityName())
-			{
-				return true;
-			}
+			return nullptr;
 		}
-		return false;
+
+		return GetEntity(itr->second);
 	}
 
 
-	bool Coordinator::IsNameRepeated(Entity e)
+	void Coordinator::SetEntityName(EntityID id, std::string name)
 	{
-		for (int i = 0; i < mEntities.size(); ++i)
+		Entity* e = GetEntity(id);
+		if (e == nullptr)
 		{
-			if (e.GetEntityName() == mEntities[i].GetEntityName() &&
-				e.GetEntityID() != mEntities[i].GetEntityID())
-			{
-				return true;
-			}
+			LOG_WARNING("Renaming non-existent entity.");
+			return;
+		}
+
+		auto itr = mEntityNames.find(e->GetEntityNameKey());
+		if (itr != mEntityNames.end() && itr->second == id)
+		{
+			mEntityNames.erase(itr);
 		}
-		return false;
+
+		e->SetEntityName(name);
+		mEntityNames[e->GetEntityNameKey()] = id;
+	}
+
+
+	std::string Coordinator::GetUniqueName(const std::string& prefix, const std::string& suffix)
+	{
+		// Suffixes only count up, so taken names are not checked again
+		int& next = mNameSuffixes[prefix];
+
+		std::string name{};
+		do
+		{
+			name = prefix + std::to_string(++next) + suffix;
+		} while (IsNameRepeated(name));
+
+		return name;
+	}
+
+
+	bool Coordinator::IsNameRepeated(std::string_view name)
+	{
+		// Names whose base was never interned cannot be used by any entity
+		return mEntityNames.find(Entity::FindNameKey(name)) != mEntityNames.end();
+	}
+
+
+	bool Coordinator::IsNameRepeated(const Entity& e)
+	{
+		auto itr = mEntityNames.find(e.GetEntityNameKey());
+		return itr != mEntityNames.end() && itr->second != e.GetEntityID();
 	}
 
 
 	bool Coordinator::EntityExists(EntityID id)
 	{
-		for (int i = 0; i < mEntities.size(); ++i)
+		return id < mEntityIndex.Size() && mEntityIndex[id] != INVALID_INDEX;
+	}
+
+
+	EntityHandle Coordinator::GetHandle(EntityID id)
+	{
+		return mEntityManager->GetHandle(id);
+	}
+
+
+	bool Coordinator::IsAlive(EntityHandle handle)
+	{
+		return mEntityManager->IsAlive(handle);
+	}
+
+
+	void Coordinator::ProcessTimedDestroys(float deltaTime)
+	{
+		mTime += deltaTime;
+
+		// Only expired timers are visited
+		EntityCommandBuffer& buffer = mCommandBuffers[0];
+		while (!mTimedDestroys.empty() && mTimedDestroys.top().time <= mTime)
 		{
-			if (id == mEntities[i].GetEntityID())
+			const EntityHandle handle = mTimedDestroys.top().handle;
+			mTimedDestroys.pop();
+
+			if (IsAlive(handle))
 			{
-				return true;
+				buffer.DestroyEntity(GetHandleEntity(handle));
 			}
 		}
-		return false;
 	}
 
 
-	bool Coordinator::CheckParentIsActive(Entity& e)
+	void Coordinator::AddEntity(const Entity& e)
+	{
+		mEntityIndex.Resize(static_cast<std::size_t>(e.GetEntityID()) + 1);
+		mEntityIndex[e.GetEntityID()] = static_cast<std::uint32_t>(mEntities.size());
+		mEntities.emplace_back(e);
+		mEntityNames[e.GetEntityNameKey()] = e.GetEntityID();
+		mHierarchy.Add(e.GetEntityID());
+
+		mEffectiveActive.Resize(static_cast<std::size_t>(e.GetEntityID()) / 64 + 1);
+		RefreshActive(e.GetEntityID());
+	}
+
+
+	void Coordinator::RemoveEntity(EntityID e)
 	{
-		if (e.GetIsActive())
+		if (!EntityExists(e))
 		{
-			EntityID parent_id = e.GetParent();
-			if (parent_id < MAX_ENTITIES)
-			{
-				Entity& parent = *GetEntity(parent_id);
-				return CheckParentIsActive(parent);
-			}
-			else
-			{
-				return e.GetIsActive();
-			}
+			return;
 		}
-		else
+
+		auto itr = mEntityNames.find(mEntities[mEntityIndex[e]].GetEntityNameKey());
+		if (itr != mEntityNames.end() && itr->second == e)
+		{
+			mEntityNames.erase(itr);
+		}
+
+		// Move last entity into removed entity's spot
+		const std::uint32_t index = mEntityIndex[e];
+		if (index != mEntities.size() - 1)
+		{
+			mEntities[index] = std::move(mEntities.back());
+			mEntityIndex[mEntities[index].GetEntityID()] = index;
+		}
+
+		mEntities.pop_back();
+		mEntityIndex[e] = INVALID_INDEX;
+	}
+
+
+	void Coordinator::SetActive(EntityID id, bool active)
+	{
+		Entity* e = GetEntity(id);
+		if (!e)
+		{
+			LOG_WARNING("Setting active state of non-existent entity.");
+			return;
+		}
+
+		e->SetIs_Active(active);
+		RefreshActive(id);
+	}
+
+
+	bool Coordinator::IsEffectivelyActive(EntityID id) const
+	{
+		// Size() is in words (Whole pages), entities never added are not active
+		const std::size_t word = static_cast<std::size_t>(id) / 64;
+		if (word >= mEffectiveActive.Size())
 		{
 			return false;
 		}
+
+		return (mEffectiveActive[word] >> (id % 64)) & 1;
+	}
+
+
+	bool Coordinator::CheckParentIsActive(Entity& e)
+	{
+		return IsEffectivelyActive(e.GetEntityID());
 	}
 
 
 	bool Coordinator::CheckParentIsActive(EntityID id)
 	{
-		Entity& e = *GetEntity(id);
-		return CheckParentIsActive(e);
+		return IsEffectivelyActive(id);
+	}
+
+
+	void Coordinator::RefreshActive(EntityID e)
+	{
+		for (EntityID id : mHierarchy.GetSubtree(e))
+		{
+			const EntityID parent = mHierarchy.GetParent(id);
+			const bool active = mEntities[mEntityIndex[id]].GetIsActive() && (parent == INVALID_ENTITY || IsEffectivelyActive(parent));
+
+			const std::uint64_t bit = std::uint64_t{ 1 } << (id % 64);
+			std::uint64_t& word = mEffectiveActive[id / 64];
+			word = active ? (word | bit) : (word & ~bit);
+		}
 	}
 
 
@@ -517,4 +831,93 @@ namespace Engine
 		return mEntityManager->GetTag(e);
 	}
 
+
+	std::size_t Coordinator::ReleaseEmptyComponentPages()
+	{
+		return mComponentManager->ReleaseEmptyPages();
+	}
+
+
+	bool Coordinator::Snapshot(WorldSnapshot& snapshot)
+	{
+		snapshot.mIsValid = false;
+		if (!mComponentManager->Snapshot(snapshot.mComponents))
+		{
+			return false;
+		}
+
+		snapshot.mEntityManager = *mEntityManager;
+		mSystemManager->Snapshot(snapshot.mSystemEntities);
+		mQueryManager->Snapshot(snapshot.mQueryEntities);
+
+		snapshot.mEntities = mEntities;
+		snapshot.mEntityIndex = mEntityIndex;
+		snapshot.mEntityNames = mEntityNames;
+		snapshot.mNameSuffixes = mNameSuffixes;
+		snapshot.mHierarchy = mHierarchy;
+		snapshot.mEffectiveActive = mEffectiveActive;
+		snapshot.mPrefabReloading = mPrefabReloading;
+		snapshot.mTimedDestroys = mTimedDestroys;
+		snapshot.mTime = mTime;
+
+		snapshot.mIsValid = true;
+		return true;
+	}
+
+
+	WorldSnapshot Coordinator::Snapshot()
+	{
+		WorldSnapshot snapshot{};
+		Snapshot(snapshot);
+		return snapshot;
+	}
+
+
+	bool Coordinator::Restore(const WorldSnapshot& snapshot)
+	{
+		if (!snapshot.IsValid())
+		{
+			LOG_WARNING("Restoring invalid snapshot.");
+			return false;
+		}
+
+		// The rest of the world is only replaced once its components are
+		if (!mComponentManager->Restore(snapshot.mComponents))
+		{
+			LOG_WARNING("Restoring snapshot failed.");
+			return false;
+		}
+
+		// Commands recorded against the current world no longer apply
+		for (EntityCommandBuffer& buffer : mCommandBuffers)
+		{
+			buffer.Clear();
+		}
+
+		*mEntityManager = snapshot.mEntityManager;
+		mSystemManager->Restore(snapshot.mSystemEntities);
+
+		mEntities = snapshot.mEntities;
+		mEntityIndex = snapshot.mEntityIndex;
+		mEntityNames = snapshot.mEntityNames;
+		mNameSuffixes = snapshot.mNameSuffixes;
+		mHierarchy = snapshot.mHierarchy;
+		mEffectiveActive = snapshot.mEffectiveActive;
+		mPrefabReloading = snapshot.mPrefabReloading;
+		mTimedDestroys = snapshot.mTimedDestroys;
+		mTime = snapshot.mTime;
+
+		// Queries created after the snapshot are matched against the restored signatures
+		mQueryManager->Restore(snapshot.mQueryEntities, [this](Query& query)
+		{
+			for (const Entity& e : mEntities)
+			{
+				EntityID id = e.GetEntityID();
+				query.EntitySignatureChanged(id, mEntityManager->GetSignature(id));
+			}
+		});
+
+		return true;
+	}
+
 } // end of namespace
\ No newline at end of file
@@ -0,0 +1,114 @@
+/******************************************************************************/
+/*!
+\file       EntityCommandBuffer.cpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the implementation of EntityCommandBuffer class.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#include "include/ECS/Architecture/EntityCommandBuffer.hpp"
+
+#include <algorithm>
+
+namespace Engine
+{
+	EntityCommandBuffer::~EntityCommandBuffer()
+	{
+		Clear();
+	}
+
+
+	EntityID EntityCommandBuffer::CreateEntity(std::string name)
+	{
+		const EntityID deferred = DEFERRED_ENTITY_BIT | static_cast<EntityID>(mCreatedNames.size());
+		mCreatedNames.emplace_back(std::move(name));
+
+		mCommands.emplace_back(Command{ CommandType::CreateEntity, deferred, nullptr, nullptr });
+		return deferred;
+	}
+
+
+	void EntityCommandBuffer::DestroyEntity(EntityID e)
+	{
+		mCommands.emplace_back(Command{ CommandType::DestroyEntity, e, nullptr, nullptr });
+	}
+
+
+	std::span<const EntityCommandBuffer::Command> EntityCommandBuffer::GetCommands() const
+	{
+		return mCommands;
+	}
+
+
+	const std::string& EntityCommandBuffer::GetCreatedName(std::size_t index) const
+	{
+		return mCreatedNames[index];
+	}
+
+
+	bool EntityCommandBuffer::Empty() const
+	{
+		return mCommands.empty();
+	}
+
+
+	void EntityCommandBuffer::Clear()
+	{
+		for (const Command& command : mCommands)
+		{
+			if (command.type == CommandType::AddComponent)
+			{
+				command.ops->destroy(command.component);
+			}
+		}
+		mCommands.clear();
+		mCreatedNames.clear();
+
+		// Memory is kept for the next commands
+		for (Block& block : mBlocks)
+		{
+			block.used = 0;
+		}
+		mCurrentBlock = 0;
+	}
+
+
+	bool EntityCommandBuffer::IsDeferred(EntityID e)
+	{
+		return e != INVALID_ENTITY && (e & DEFERRED_ENTITY_BIT);
+	}
+
+
+	void* EntityCommandBuffer::Allocate(std::size_t size, std::size_t alignment)
+	{
+		for (; mCurrentBlock < mBlocks.size(); ++mCurrentBlock)
+		{
+			Block& block = mBlocks[mCurrentBlock];
+			void* memory = block.data.get() + block.used;
+			std::size_t space = block.size - block.used;
+			if (std::align(alignment, size, memory, space))
+			{
+				block.used = block.size - space + size;
+				return memory;
+			}
+		}
+
+		// Blocks never move, so components are not relocated when more memory is needed
+		Block block{};
+		block.size = (std::max)(BLOCK_SIZE, size + alignment);
+		block.data = std::make_unique<std::byte[]>(block.size);
+		mBlocks.emplace_back(std::move(block));
+		mCurrentBlock = mBlocks.size() - 1;
+
+		return Allocate(size, alignment);
+	}
+
+} // end of namespace
@@ -21,13 +21,55 @@
 #include "include/Logging.hpp"
 
 #include <string>
+#include <utility>
+#include <algorithm>
 
 namespace Engine
 {
-	Entity::Entity(EntityID __id__, std::string __name__) : id{ __id__ }, parent{ MAX_ENTITIES + 1 }, is_parent{ false }, is_child{ false }, isActive{ true }, name{ __name__ } {}
+	namespace
+	{
+		// Splits "base(n)" into "base(" and n (n > 0 without leading zeros), else name and 0
+		std::pair<std::string_view, std::uint32_t> SplitName(std::string_view name)
+		{
+			const std::size_t open = name.rfind('(');
+			if (open == std::string_view::npos || name.back() != ')')
+			{
+				return { name, 0 };
+			}
+
+			const std::string_view digits = name.substr(open + 1, name.size() - open - 2);
+			if (digits.empty() || digits.size() > 9 || digits.front() == '0' ||
+				!std::all_of(digits.begin(), digits.end(), [](char c) { return c >= '0' && c <= '9'; }))
+			{
+				return { name, 0 };
+			}
+
+			std::uint32_t number = 0;
+			for (char c : digits)
+			{
+				number = number * 10 + static_cast<std::uint32_t>(c - '0');
+			}
+			return { name.substr(0, open + 1), number };
+		}
+
+
+		std::uint64_t NameKey(StringID base, std::uint32_t number)
+		{
+			return static_cast<std::uint64_t>(base) << 32 | number;
+		}
+	}
+
+
+	Entity::Entity(EntityID __id__, std::string __name__) : id{ __id__ }, parent{ INVALID_ENTITY }, is_child{ false }, is_parent{ false }, isActive{ true }
+	{
+		SetEntityName(std::move(__name__));
+	}
 
 	Entity::Entity(EntityID __id__, EntityID __parent__, std::string __name__) :
-		id{ __id__ }, parent{ __parent__ }, name{ __name__ }, is_parent{ false }, is_child{ true }, isActive{ true } {};
+		id{ __id__ }, parent{ __parent__ }, is_child{ true }, is_parent{ false }, isActive{ true }
+	{
+		SetEntityName(std::move(__name__));
+	}
 
 
 	EntityID Entity::GetEntityID() const
@@ -38,23 +80,69 @@ namespace Engine
 
 	void Entity::SetEntityName(std::string __name__)
 	{
-		name = __name__;
+		if (__name__.empty())
+		{
+			name = StringTable::EMPTY_STRING;
+			nameNumber = 0;
+			return;
+		}
+
+		const auto [base, number] = SplitName(__name__);
+		name = StringTable::Intern(base);
+		nameNumber = number;
 	}
 
 
 	std::string Entity::GetEntityName() const
+	{
+		if (nameNumber == 0)
+		{
+			return std::string{ StringTable::Get(name) };
+		}
+
+		return std::string{ StringTable::Get(name) } + std::to_string(nameNumber) + ")";
+	}
+
+
+	std::string_view Entity::GetEntityNameView() const
+	{
+		return StringTable::Get(name);
+	}
+
+
+	StringID Entity::GetEntityNameID() const
 	{
 		return name;
 	}
 
 
+	std::uint32_t Entity::GetEntityNameNumber() const
+	{
+		return nameNumber;
+	}
+
+
+	std::uint64_t Entity::GetEntityNameKey() const
+	{
+		return NameKey(name, nameNumber);
+	}
+
+
+	std::uint64_t Entity::FindNameKey(std::string_view __name__)
+	{
+		const auto [base, number] = SplitName(__name__);
+		return NameKey(StringTable::Find(base), number);
+	}
+
+
 	void Entity::Copy(const Entity& rhs)
 	{
 		is_child = rhs.is_child;
 		is_parent = rhs.is_parent;
 		isActive = rhs.isActive;
 
-		prefab = rhs.GetPrefab();
+		prefab = rhs.prefab;
+		tag = rhs.tag;
 	}
 
 
@@ -96,11 +184,23 @@ namespace Engine
 
 	void Entity::SetPrefab(std::string __prefab__)
 	{
-		prefab = __prefab__;
+		prefab = StringTable::Intern(__prefab__);
 	}
 
 
 	std::string Entity::GetPrefab() const
+	{
+		return std::string{ StringTable::Get(prefab) };
+	}
+
+
+	std::string_view Entity::GetPrefabView() const
+	{
+		return StringTable::Get(prefab);
+	}
+
+
+	StringID Entity::GetPrefabID() const
 	{
 		return prefab;
 	}
@@ -108,11 +208,23 @@ namespace Engine
 
 	void Entity::SetKeyTag(std::string __tag__)
 	{
-		tag = __tag__;
+		tag = StringTable::Intern(__tag__);
 	}
 
 
 	std::string Entity::GetKeyTag() const
+	{
+		return std::string{ StringTable::Get(tag) };
+	}
+
+
+	std::string_view Entity::GetKeyTagView() const
+	{
+		return StringTable::Get(tag);
+	}
+
+
+	StringID Entity::GetKeyTagID() const
 	{
 		return tag;
 	}
@@ -132,11 +244,6 @@ namespace Engine
 
 	EntityManager::EntityManager() : EntityCount{ 0 }
 	{
-		// Initialize the queue that contains entity IDs up to MAX_ENTITIES.
-		for (EntityID entity = 0; entity < MAX_ENTITIES; ++entity)
-		{
-			AvailableEntities.emplace(entity);
-		}
 	}
 
 
@@ -144,9 +251,22 @@ namespace Engine
 	{
 		LOG_ASSERT(EntityCount < MAX_ENTITIES && "Number of entities exceeds MAX_ENTITIES");
 
-		// Take an ID from the front of the queue
-		EntityID id = AvailableEntities.front();
-		AvailableEntities.pop();
+		// Reuse most recently freed ID, else take a new one
+		EntityID id = FreeListHead;
+		if (id != END_OF_FREE_LIST)
+		{
+			FreeListHead = EntitiesRecords[id].nextFree;
+		}
+		else
+		{
+			LOG_ASSERT(NextUnusedEntity < MAX_ENTITIES && "Entity IDs exhausted (Including retired IDs)");
+
+			// Allocate pages of records and tags when a new ID exceeds them (Existing records are not moved)
+			id = NextUnusedEntity++;
+			EntitiesRecords.Resize(NextUnusedEntity);
+			EntitiesTags.Resize(NextUnusedEntity);
+		}
+		EntitiesRecords[id].alive = true;
 
 		++EntityCount;
 
@@ -155,7 +275,7 @@ namespace Engine
 			__name__ = DEFAULT_ENTITY_NAME + std::to_string(id);
 		}
 
-		if (_parent < MAX_ENTITIES)
+		if (_parent != INVALID_ENTITY)
 		{
 			return Entity(id, _parent, __name__);
 		}
@@ -164,6 +284,41 @@ namespace Engine
 	}
 
 
+	std::vector<EntityID> EntityManager::CreateEntities(std::size_t count, Signature signature)
+	{
+		LOG_ASSERT(EntityCount + count <= MAX_ENTITIES && "Number of entities exceeds MAX_ENTITIES");
+
+		std::vector<EntityID> ids{};
+		ids.reserve(count);
+
+		// Most recently freed IDs first
+		while (ids.size() < count && FreeListHead != END_OF_FREE_LIST)
+		{
+			ids.emplace_back(FreeListHead);
+			FreeListHead = EntitiesRecords[FreeListHead].nextFree;
+		}
+
+		// The rest are new IDs, pages are allocated once for all of them
+		const std::size_t fresh = count - ids.size();
+		LOG_ASSERT(NextUnusedEntity + fresh <= MAX_ENTITIES && "Entity IDs exhausted (Including retired IDs)");
+		EntitiesRecords.Resize(NextUnusedEntity + fresh);
+		EntitiesTags.Resize(NextUnusedEntity + fresh);
+		for (std::size_t i = 0; i < fresh; ++i)
+		{
+			ids.emplace_back(NextUnusedEntity++);
+		}
+
+		for (EntityID e : ids)
+		{
+			EntitiesRecords[e].alive = true;
+			EntitiesRecords[e].signature = signature;
+		}
+		EntityCount += static_cast<unsigned int>(count);
+
+		return ids;
+	}
+
+
 	// Helper function to create a child object
 	Entity EntityManager::CreateChild(EntityID parent, const std::string& __name__)
 	{
@@ -173,29 +328,40 @@ namespace Engine
 
 	void EntityManager::DestroyEntity(Entity& e)
 	{
-		LOG_ASSERT(e.GetEntityID() < MAX_ENTITIES && "Entity is out of range.");
-
-		// Resets the signature bits (reset to zero)
-		EntitiesSignatures[e.GetEntityID()].reset();
-		EntitiesTags[e.GetEntityID()].reset();
-
-		// Move ID to the back of queue (to be reused)
-		AvailableEntities.push(e.GetEntityID());
-
-		--EntityCount;
+		EntityID id = e.GetEntityID();
+		DestroyEntity(id);
 	}
 
 
 	void EntityManager::DestroyEntity(EntityID& e)
 	{
-		LOG_ASSERT(e < MAX_ENTITIES && "Entity is out of range.");
+		LOG_ASSERT(e < NextUnusedEntity && "Entity is out of range.");
+
+		EntityRecord& record = EntitiesRecords[e];
+		if (!record.alive)
+		{
+			LOG_WARNING("Destroying non-existent entity.");
+			return;
+		}
 
 		// Resets the signature bits (reset to zero)
-		EntitiesSignatures[e].reset();
+		record.signature.reset();
 		EntitiesTags[e].reset();
 
-		// Move ID to the back of queue (to be reused)
-		AvailableEntities.push(e);
+		// Invalidate handles to this entity and push ID to the front of free list (to be reused)
+		record.generation = (record.generation + 1) & HANDLE_GENERATION_MASK;
+		record.alive = false;
+
+		// Every generation was used, the ID is retired so stale handles can never match a new entity
+		if (record.generation == 0)
+		{
+			record.nextFree = END_OF_FREE_LIST;
+		}
+		else
+		{
+			record.nextFree = FreeListHead;
+			FreeListHead = e;
+		}
 
 		--EntityCount;
 	}
@@ -203,23 +369,23 @@ namespace Engine
 
 	void EntityManager::SetSignature(Entity& e, Signature s)
 	{
-		LOG_ASSERT(e.GetEntityID() < MAX_ENTITIES && "Entity is out of range.");
+		LOG_ASSERT(e.GetEntityID() < NextUnusedEntity && "Entity is out of range.");
 
-		EntitiesSignatures[e.GetEntityID()] = s;
+		EntitiesRecords[e.GetEntityID()].signature = s;
 	}
 
 
 	void EntityManager::SetSignature(EntityID& e, Signature s)
 	{
-		LOG_ASSERT(e < MAX_ENTITIES && "Entity is out of range.");
+		LOG_ASSERT(e < NextUnusedEntity && "Entity is out of range.");
 
-		EntitiesSignatures[e] = s;
+		EntitiesRecords[e].signature = s;
 	}
 
 
 	void EntityManager::SetTag(EntityID e, Tag t)
 	{
-		LOG_ASSERT(e < MAX_ENTITIES && "Entity is out of range.");
+		LOG_ASSERT(e < NextUnusedEntity && "Entity is out of range.");
 
 		EntitiesTags[e] = t;
 	}
@@ -227,23 +393,50 @@ namespace Engine
 
 	Signature EntityManager::GetSignature(Entity& e)
 	{
-		LOG_ASSERT(e.GetEntityID() < MAX_ENTITIES && "Entity is out of range.");
+		LOG_ASSERT(e.GetEntityID() < NextUnusedEntity && "Entity is out of range.");
 
-		return EntitiesSignatures[e.GetEntityID()];
+		return EntitiesRecords[e.GetEntityID()].signature;
 	}
 
 
 	Signature EntityManager::GetSignature(EntityID& e)
 	{
-		LOG_ASSERT(e < MAX_ENTITIES && "Entity is out of range.");
+		LOG_ASSERT(e < NextUnusedEntity && "Entity is out of range.");
 
-		return EntitiesSignatures[e];
+		return EntitiesRecords[e].signature;
+	}
+
+
+	bool EntityManager::HasComponent(EntityID e, ComponentType type) const
+	{
+		return e < NextUnusedEntity && EntitiesRecords[e].signature.test(type);
+	}
+
+
+	EntityHandle EntityManager::GetHandle(EntityID e) const
+	{
+		LOG_ASSERT(e < NextUnusedEntity && "Entity is out of range.");
+
+		return MakeHandle(e, EntitiesRecords[e].generation);
+	}
+
+
+	bool EntityManager::IsAlive(EntityHandle h) const
+	{
+		const EntityID e = GetHandleEntity(h);
+		return IsInUse(e) && EntitiesRecords[e].generation == GetHandleGeneration(h);
+	}
+
+
+	bool EntityManager::IsInUse(EntityID e) const
+	{
+		return e < NextUnusedEntity && EntitiesRecords[e].alive;
 	}
 
 
 	Tag EntityManager::GetTag(EntityID e)
 	{
-		LOG_ASSERT(e < MAX_ENTITIES && "Entity is out of range.");
+		LOG_ASSERT(e < NextUnusedEntity && "Entity is out of range.");
 
 		return EntitiesTags[e];
 	}
@@ -0,0 +1,345 @@
+/******************************************************************************/
+/*!
+\file       Hierarchy.cpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the implementation of Hierarchy class.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#include "include/ECS/Architecture/Hierarchy.hpp"
+#include "include/Logging.hpp"
+
+#include <algorithm>
+
+namespace Engine
+{
+	void Hierarchy::Add(EntityID e)
+	{
+		mNodes.Resize(static_cast<std::size_t>(e) + 1);
+
+		Node& node = mNodes[e];
+		node = Node{};
+		node.index = static_cast<std::uint32_t>(mOrder.size());
+		node.size = 1;
+		mOrder.emplace_back(e);
+	}
+
+
+	void Hierarchy::Add(std::span<const EntityID> entities)
+	{
+		if (entities.empty())
+		{
+			return;
+		}
+
+		// Pages of nodes are allocated once, for the largest ID
+		mNodes.Resize(static_cast<std::size_t>(*std::max_element(entities.begin(), entities.end())) + 1);
+		mOrder.reserve(mOrder.size() + entities.size());
+
+		for (EntityID e : entities)
+		{
+			Node& node = mNodes[e];
+			node = Node{};
+			node.index = static_cast<std::uint32_t>(mOrder.size());
+			node.size = 1;
+			mOrder.emplace_back(e);
+		}
+	}
+
+
+	void Hierarchy::Remove(std::span<const EntityID> entities)
+	{
+		auto IsRemoved = [&entities](EntityID e)
+		{
+			return std::binary_search(entities.begin(), entities.end(), e);
+		};
+
+		// Only the top-most removed entities are linked to entities that stay, each of their
+		// subtrees is a contiguous range of the order
+		std::vector<std::pair<std::uint32_t, std::uint32_t>> ranges{};
+		for (EntityID e : entities)
+		{
+			if (!Contains(e))
+			{
+				continue;
+			}
+
+			const Node& node = mNodes[e];
+			if (node.parent == INVALID_ENTITY || !IsRemoved(node.parent))
+			{
+				ranges.emplace_back(node.index, node.index + node.size);
+			}
+
+			if (node.parent != INVALID_ENTITY && !IsRemoved(node.parent))
+			{
+				AddSize(node.parent, -static_cast<std::int64_t>(node.size));
+				Unlink(e);
+			}
+		}
+
+		for (EntityID e : entities)
+		{
+			if (Contains(e))
+			{
+				mNodes[e] = Node{};
+			}
+		}
+
+		if (ranges.empty())
+		{
+			return;
+		}
+
+		// Single pass to close the gaps, entities before the first removed range stay where they are
+		std::sort(ranges.begin(), ranges.end());
+		auto write = mOrder.begin() + ranges.front().first;
+		for (std::size_t i = 0; i < ranges.size(); ++i)
+		{
+			auto keep = mOrder.begin() + ranges[i].second;
+			auto keepEnd = i + 1 < ranges.size() ? mOrder.begin() + ranges[i + 1].first : mOrder.end();
+			write = std::move(keep, keepEnd, write);
+		}
+		mOrder.erase(write, mOrder.end());
+		Reindex(ranges.front().first, mOrder.size());
+	}
+
+
+	void Hierarchy::Clear()
+	{
+		mNodes.Clear();
+		mOrder.clear();
+		mChanges.clear();
+	}
+
+
+	bool Hierarchy::Attach(EntityID parent, EntityID child, Tick tick)
+	{
+		if (parent == child || IsDescendant(child, parent))
+		{
+			LOG_WARNING("Attaching entity to itself or one of its children.");
+			return false;
+		}
+
+		if (mNodes[child].parent != INVALID_ENTITY)
+		{
+			Detach(child);
+		}
+
+		// Subtree goes right after the parent's last descendant
+		const Node& parentNode = mNodes[parent];
+		Move(mNodes[child].index, mNodes[child].size, parentNode.index + parentNode.size);
+
+		Node& node = mNodes[child];
+		node.parent = parent;
+		node.prevSibling = mNodes[parent].lastChild;
+		if (node.prevSibling != INVALID_ENTITY)
+		{
+			mNodes[node.prevSibling].nextSibling = child;
+		}
+		else
+		{
+			mNodes[parent].firstChild = child;
+		}
+		mNodes[parent].lastChild = child;
+
+		Stamp(child, tick);
+
+		AddDepth(child, static_cast<std::int64_t>(mNodes[parent].depth) + 1);
+		AddSize(parent, node.size);
+		return true;
+	}
+
+
+	void Hierarchy::Detach(EntityID child, Tick tick)
+	{
+		Node& node = mNodes[child];
+		if (node.parent == INVALID_ENTITY)
+		{
+			return;
+		}
+		Stamp(child, tick);
+
+		// Right after the former root's subtree (Before its size shrinks), so only that subtree is moved
+		EntityID root = node.parent;
+		while (mNodes[root].parent != INVALID_ENTITY)
+		{
+			root = mNodes[root].parent;
+		}
+		const std::uint32_t to = mNodes[root].index + mNodes[root].size;
+
+		AddSize(node.parent, -static_cast<std::int64_t>(node.size));
+		Unlink(child);
+		AddDepth(child, -static_cast<std::int64_t>(node.depth));
+
+		Move(node.index, node.size, to);
+	}
+
+
+	bool Hierarchy::Contains(EntityID e) const
+	{
+		return e < mNodes.Size() && mNodes[e].index != INVALID_INDEX;
+	}
+
+
+	const Hierarchy::Node& Hierarchy::GetNode(EntityID e) const
+	{
+		return mNodes[e];
+	}
+
+
+	EntityID Hierarchy::GetParent(EntityID e) const
+	{
+		return mNodes[e].parent;
+	}
+
+
+	EntityID Hierarchy::GetFirstChild(EntityID e) const
+	{
+		return mNodes[e].firstChild;
+	}
+
+
+	EntityID Hierarchy::GetNextSibling(EntityID e) const
+	{
+		return mNodes[e].nextSibling;
+	}
+
+
+	std::uint32_t Hierarchy::GetDepth(EntityID e) const
+	{
+		return mNodes[e].depth;
+	}
+
+
+	bool Hierarchy::IsDescendant(EntityID ancestor, EntityID e) const
+	{
+		const Node& node = mNodes[ancestor];
+		const std::uint32_t index = mNodes[e].index;
+		return index > node.index && index < node.index + node.size;
+	}
+
+
+	std::span<const EntityID> Hierarchy::GetSubtree(EntityID e) const
+	{
+		const Node& node = mNodes[e];
+		return std::span<const EntityID>(mOrder).subspan(node.index, node.size);
+	}
+
+
+	std::span<const EntityID> Hierarchy::GetOrder() const
+	{
+		return mOrder;
+	}
+
+
+	std::span<const Hierarchy::Change> Hierarchy::GetChanges(Tick since) const
+	{
+		auto first = std::upper_bound(mChanges.begin(), mChanges.end(), since, [](Tick tick, const Change& change)
+		{
+			return tick < change.tick;
+		});
+		return std::span<const Change>(first, mChanges.end());
+	}
+
+
+	void Hierarchy::TrimChanges(Tick tick)
+	{
+		auto last = std::upper_bound(mChanges.begin(), mChanges.end(), tick, [](Tick since, const Change& change)
+		{
+			return since < change.tick;
+		});
+		mChanges.erase(mChanges.begin(), last);
+	}
+
+
+	void Hierarchy::Move(std::uint32_t from, std::uint32_t count, std::uint32_t to)
+	{
+		auto begin = mOrder.begin();
+
+		if (to < from)
+		{
+			std::rotate(begin + to, begin + from, begin + from + count);
+			Reindex(to, from + count);
+		}
+		else if (to > from + count)
+		{
+			std::rotate(begin + from, begin + from + count, begin + to);
+			Reindex(from, to);
+		}
+	}
+
+
+	void Hierarchy::Reindex(std::size_t begin, std::size_t end)
+	{
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			mNodes[mOrder[i]].index = static_cast<std::uint32_t>(i);
+		}
+	}
+
+
+	void Hierarchy::AddDepth(EntityID e, std::int64_t delta)
+	{
+		for (EntityID descendant : GetSubtree(e))
+		{
+			mNodes[descendant].depth = static_cast<std::uint32_t>(mNodes[descendant].depth + delta);
+		}
+	}
+
+
+	void Hierarchy::AddSize(EntityID e, std::int64_t delta)
+	{
+		for (; e != INVALID_ENTITY; e = mNodes[e].parent)
+		{
+			mNodes[e].size = static_cast<std::uint32_t>(mNodes[e].size + delta);
+		}
+	}
+
+
+	void Hierarchy::Unlink(EntityID child)
+	{
+		Node& node = mNodes[child];
+		Node& parent = mNodes[node.parent];
+
+		if (node.prevSibling != INVALID_ENTITY)
+		{
+			mNodes[node.prevSibling].nextSibling = node.nextSibling;
+		}
+		else
+		{
+			parent.firstChild = node.nextSibling;
+		}
+
+		if (node.nextSibling != INVALID_ENTITY)
+		{
+			mNodes[node.nextSibling].prevSibling = node.prevSibling;
+		}
+		else
+		{
+			parent.lastChild = node.prevSibling;
+		}
+
+		node.parent = INVALID_ENTITY;
+		node.prevSibling = INVALID_ENTITY;
+		node.nextSibling = INVALID_ENTITY;
+	}
+
+
+	void Hierarchy::Stamp(EntityID e, Tick tick)
+	{
+		mNodes[e].version = tick;
+		if (tick != 0)
+		{
+			mChanges.emplace_back(Change{ e, tick });
+		}
+	}
+
+} // end of namespace
\ No newline at end of file
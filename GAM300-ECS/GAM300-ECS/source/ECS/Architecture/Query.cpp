@@ -0,0 +1,145 @@
+/******************************************************************************/
+/*!
+\file       Query.cpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the implementation of Query and QueryManager class.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#include "include/ECS/Architecture/Query.hpp"
+
+namespace Engine
+{
+	Query::Query(const Signature& include, const Signature& exclude) :
+		mInclude{ include }, mExclude{ exclude }
+	{
+	}
+
+
+	bool Query::Matches(const Signature& signature) const
+	{
+		return signature.Contains(mInclude) && !signature.Intersects(mExclude);
+	}
+
+
+	void Query::EntitySignatureChanged(EntityID e, const Signature& signature)
+	{
+		if (Matches(signature))
+		{
+			mEntities.insert(e);
+		}
+		else
+		{
+			mEntities.erase(e);
+		}
+	}
+
+
+	void Query::EntitiesCreated(std::span<const EntityID> entities, const Signature& signature)
+	{
+		if (Matches(signature))
+		{
+			mEntities.insert(entities);
+		}
+	}
+
+
+	void Query::EntityDestroyed(EntityID e)
+	{
+		mEntities.erase(e);
+	}
+
+
+	void Query::EntitiesDestroyed(std::span<const EntityID> entities)
+	{
+		for (EntityID e : entities)
+		{
+			if (mEntities.empty())
+			{
+				return;
+			}
+			mEntities.erase(e);
+		}
+	}
+
+
+	const EntitySet& Query::GetEntities() const
+	{
+		return mEntities;
+	}
+
+
+	void Query::SetEntities(const EntitySet& entities)
+	{
+		mEntities = entities;
+	}
+
+
+	void QueryManager::EntitySignatureChanged(EntityID e, const Signature& signature)
+	{
+		for (Query* query : mActiveQueries)
+		{
+			query->EntitySignatureChanged(e, signature);
+		}
+	}
+
+
+	void QueryManager::EntitiesCreated(std::span<const EntityID> entities, const Signature& signature)
+	{
+		for (Query* query : mActiveQueries)
+		{
+			query->EntitiesCreated(entities, signature);
+		}
+	}
+
+
+	void QueryManager::DestroyEntity(EntityID e)
+	{
+		for (Query* query : mActiveQueries)
+		{
+			query->EntityDestroyed(e);
+		}
+	}
+
+
+	void QueryManager::DestroyEntities(std::span<const EntityID> entities)
+	{
+		for (Query* query : mActiveQueries)
+		{
+			query->EntitiesDestroyed(entities);
+		}
+	}
+
+
+	void QueryManager::Snapshot(std::vector<std::optional<EntitySet>>& sets) const
+	{
+		sets.resize(mQueries.size());
+		for (std::size_t id = 0; id < mQueries.size(); ++id)
+		{
+			if (mQueries[id])
+			{
+				sets[id] = mQueries[id]->GetEntities();
+			}
+			else
+			{
+				sets[id].reset();
+			}
+		}
+	}
+
+
+	void QueryManager::Clear()
+	{
+		mActiveQueries.clear();
+		mQueries.clear();
+	}
+
+} // end of namespace
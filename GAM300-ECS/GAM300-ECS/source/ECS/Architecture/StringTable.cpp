@@ -0,0 +1,75 @@
+/******************************************************************************/
+/*!
+\file       StringTable.cpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the implementation of StringTable class.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#include "include/ECS/Architecture/StringTable.hpp"
+
+namespace Engine
+{
+	StringTable::StringTable()
+	{
+		mStrings.emplace_back();
+		mIDs.emplace(std::string_view{}, EMPTY_STRING);
+	}
+
+
+	StringTable& StringTable::Instance()
+	{
+		// Constructed on first use, entities may be created during static initialization (RTTR)
+		static StringTable table{};
+		return table;
+	}
+
+
+	StringID StringTable::Intern(std::string_view str)
+	{
+		if (str.empty())
+		{
+			return EMPTY_STRING;
+		}
+
+		StringTable& table = Instance();
+		if (auto itr = table.mIDs.find(str); itr != table.mIDs.end())
+		{
+			return itr->second;
+		}
+
+		const StringID id = static_cast<StringID>(table.mStrings.size());
+		const std::string& stored = table.mStrings.emplace_back(str);
+		table.mIDs.emplace(std::string_view{ stored }, id);
+		return id;
+	}
+
+
+	StringID StringTable::Find(std::string_view str)
+	{
+		StringTable& table = Instance();
+		auto itr = table.mIDs.find(str);
+		return itr != table.mIDs.end() ? itr->second : INVALID_STRING;
+	}
+
+
+	std::string_view StringTable::Get(StringID id)
+	{
+		return Instance().mStrings[id];
+	}
+
+
+	std::size_t StringTable::Size()
+	{
+		return Instance().mStrings.size();
+	}
+
+} // end of namespace
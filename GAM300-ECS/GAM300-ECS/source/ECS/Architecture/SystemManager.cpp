@@ -31,11 +31,12 @@ namespace Engine
 	void SystemManager::DestroyEntity(Entity& e)
 	{
 		// Erase entity from all systems
-		for (auto const& pair : mSystems)
+		for (auto const& system : mSystems)
 		{
-			auto const& system = pair.second;
-
-			system->mEntities.erase(e.GetEntityID());
+			if (system)
+			{
+				system->mEntities.erase(e.GetEntityID());
+			}
 		}
 	}
 
@@ -43,64 +44,163 @@ namespace Engine
 	void SystemManager::DestroyEntity(EntityID& e)
 	{
 		// Erase entity from all systems
-		for (auto const& pair : mSystems)
+		for (auto const& system : mSystems)
 		{
-			auto const& system = pair.second;
-
-			system->mEntities.erase(e);
+			if (system)
+			{
+				system->mEntities.erase(e);
+			}
 		}
 	}
 
 
-	void SystemManager::EntitySignatureChanged(Entity& e, Signature signature)
+	void SystemManager::DestroyEntities(std::span<const EntityID> entities)
 	{
-		// Notify each system that an entity's signature changed
-		for (auto const& pair : mSystems)
+		for (auto const& system : mSystems)
 		{
-			auto const& name = pair.first;
-			auto const& system = pair.second;
-			auto const& systemSignatures = mSignatures[name];
+			if (system == nullptr)
+			{
+				continue;
+			}
 
-			for (auto sig : systemSignatures)
+			for (EntityID e : entities)
 			{
-				// Entity's signature matches system signature
-				if ((signature & sig) == sig)
+				if (system->mEntities.empty())
 				{
-					system->mEntities.insert(e.GetEntityID());
-				}
-				// Entity's signature does not match system signature
-				else
-				{
-					system->mEntities.erase(e.GetEntityID());
+					break;
 				}
+				system->mEntities.erase(e);
 			}
 		}
 	}
 
 
+	void SystemManager::EntitySignatureChanged(Entity& e, Signature signature)
+	{
+		EntityID id = e.GetEntityID();
+		EntitySignatureChanged(id, signature);
+	}
+
+
 	void SystemManager::EntitySignatureChanged(EntityID& e, Signature signature)
 	{
 		// Notify each system that an entity's signature changed
-		for (auto const& pair : mSystems)
+		for (std::size_t id = 0; id < mSystems.size(); ++id)
+		{
+			UpdateSystemEntity(id, e, signature);
+		}
+	}
+
+
+	void SystemManager::EntitySignatureChanged(EntityID e, Signature signature, ComponentType changed)
+	{
+		// Systems without the changed type in their signatures are not affected
+		for (std::size_t id : mInterestedSystems[changed])
 		{
-			auto const& name = pair.first;
-			auto const& system = pair.second;
-			auto const& systemSignatures = mSignatures[name];
+			UpdateSystemEntity(id, e, signature);
+		}
+	}
 
-			for (auto sig : systemSignatures)
+
+	void SystemManager::EntitySignatureChanged(EntityID e, const Signature& signature, const Signature& changed)
+	{
+		for (std::size_t id = 0; id < mSystems.size(); ++id)
+		{
+			if (mSignatureMasks[id].Intersects(changed))
 			{
-				// Entity's signature matches system signature
-				if ((signature & sig) == sig)
-				{
-					system->mEntities.insert(e);
-				}
-				// Entity's signature does not match system signature
-				else
+				UpdateSystemEntity(id, e, signature);
+			}
+		}
+	}
+
+
+	void SystemManager::EntitiesCreated(std::span<const EntityID> entities, const Signature& signature)
+	{
+		for (std::size_t id = 0; id < mSystems.size(); ++id)
+		{
+			if (mSystems[id] == nullptr || !mSignatureMasks[id].Intersects(signature))
+			{
+				continue;
+			}
+
+			for (auto const& sig : mSignatures[id])
+			{
+				if (signature.Contains(sig))
 				{
-					system->mEntities.erase(e);
+					mSystems[id]->mEntities.insert(entities);
+					break;
 				}
 			}
 		}
 	}
 
+
+	void SystemManager::UpdateSystems(Coordinator* coordinator, float deltaTime, JobSystem& jobs)
+	{
+		if (mScheduleDirty)
+		{
+			std::vector<System*> systems{};
+			std::vector<SystemAccess> access{};
+			for (std::size_t id : mRegistrationOrder)
+			{
+				systems.emplace_back(mSystems[id].get());
+				access.emplace_back(mAccess[id]);
+			}
+
+			mScheduler.Build(systems, access);
+			mScheduleDirty = false;
+		}
+
+		mScheduler.Run(coordinator, deltaTime, jobs);
+	}
+
+
+	void SystemManager::UpdateSystemEntity(std::size_t id, EntityID e, const Signature& signature)
+	{
+		auto const& system = mSystems[id];
+		if (system == nullptr)
+		{
+			return;
+		}
+
+		for (auto const& sig : mSignatures[id])
+		{
+			// Entity's signature matches system signature
+			if (signature.Contains(sig))
+			{
+				system->mEntities.insert(e);
+				return;
+			}
+		}
+
+		// Entity's signature does not match any system signature
+		system->mEntities.erase(e);
+	}
+
+
+	void SystemManager::Snapshot(std::vector<EntitySet>& sets) const
+	{
+		sets.resize(mSystems.size());
+		for (std::size_t id = 0; id < mSystems.size(); ++id)
+		{
+			if (mSystems[id])
+			{
+				sets[id] = mSystems[id]->mEntities;
+			}
+		}
+	}
+
+
+	void SystemManager::Restore(const std::vector<EntitySet>& sets)
+	{
+		const std::size_t count = (std::min)(sets.size(), mSystems.size());
+		for (std::size_t id = 0; id < count; ++id)
+		{
+			if (mSystems[id])
+			{
+				mSystems[id]->mEntities = sets[id];
+			}
+		}
+	}
+
 } // end of namespace
\ No newline at end of file
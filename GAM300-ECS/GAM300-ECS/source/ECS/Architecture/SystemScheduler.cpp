@@ -0,0 +1,102 @@
+/******************************************************************************/
+/*!
+\file       SystemScheduler.cpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the implementation of SystemScheduler class.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#include "include/ECS/Architecture/SystemScheduler.hpp"
+#include "include/ECS/Architecture/Coordinator.hpp"
+
+namespace Engine
+{
+	void SystemScheduler::Build(const std::vector<System*>& systems, const std::vector<SystemAccess>& access)
+	{
+		mNodes.assign(systems.size(), Node{});
+		mWaves.clear();
+
+		std::vector<std::size_t> waves(systems.size(), 0);
+		for (std::size_t i = 0; i < systems.size(); ++i)
+		{
+			mNodes[i].system = systems[i];
+			mNodes[i].mainThread = access[i].mainThread;
+
+			// Runs after every earlier conflicting system
+			for (std::size_t j = 0; j < i; ++j)
+			{
+				if (Conflicts(access[j], access[i]))
+				{
+					waves[i] = (std::max)(waves[i], waves[j] + 1);
+				}
+			}
+
+			if (waves[i] >= mWaves.size())
+			{
+				mWaves.resize(waves[i] + 1);
+			}
+			mWaves[waves[i]].emplace_back(i);
+		}
+	}
+
+
+	void SystemScheduler::Run(Coordinator* coordinator, float deltaTime, JobSystem& jobs)
+	{
+		for (const std::vector<std::size_t>& wave : mWaves)
+		{
+			RunWave(wave, coordinator, deltaTime, jobs);
+		}
+	}
+
+
+	bool SystemScheduler::Conflicts(const SystemAccess& a, const SystemAccess& b)
+	{
+		if (!a.declared || !b.declared || (a.mainThread && b.mainThread))
+		{
+			return true;
+		}
+
+		return a.writes.Intersects(b.reads | b.writes) || b.writes.Intersects(a.reads);
+	}
+
+
+	void SystemScheduler::RunWave(const std::vector<std::size_t>& wave, Coordinator* coordinator, float deltaTime, JobSystem& jobs)
+	{
+		// Components changed by the wave's systems are stamped with this tick
+		const Tick tick = coordinator->AdvanceChangeTick();
+
+		JobCounter counter{};
+		for (std::size_t node : wave)
+		{
+			if (!mNodes[node].mainThread)
+			{
+				System* system = mNodes[node].system;
+				jobs.Run([system, coordinator, deltaTime]() { system->Update(coordinator, deltaTime); }, &counter);
+			}
+		}
+
+		// At most one main thread system per wave (They conflict with each other)
+		for (std::size_t node : wave)
+		{
+			if (mNodes[node].mainThread)
+			{
+				mNodes[node].system->Update(coordinator, deltaTime);
+			}
+		}
+		jobs.Wait(counter);
+
+		for (std::size_t node : wave)
+		{
+			mNodes[node].system->mLastRunTick = tick;
+		}
+	}
+
+} // end of namespace
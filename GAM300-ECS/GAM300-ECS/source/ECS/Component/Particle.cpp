@@ -35,9 +35,9 @@
 
 #define PI 3.14159265358979323846
 
-std::random_device rd;  // Used to obtain a seed for the random number engine
-std::mt19937 gen(rd()); // Standard mersenne_twister_engine seeded with rd()
-std::uniform_real_distribution<> dis(0.0, 1.0);
+// Per thread, particles are updated in parallel (See ParticleSystem::Update)
+thread_local std::mt19937 gen(std::random_device{}()); // Standard mersenne_twister_engine seeded with random_device
+thread_local std::uniform_real_distribution<> dis(0.0, 1.0);
 
 template <typename T>
 T lerp(T a, T b, float t) 
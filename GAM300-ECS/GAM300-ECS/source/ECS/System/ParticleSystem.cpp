@@ -46,13 +46,16 @@ namespace Engine
 		const auto& shd_ref_handle = shdrpgms[GraphicShader::Default].GetHandle();
 		glUseProgram(shd_ref_handle);
 
-		Renderer::BeginCubeBatch();
-
-		for (auto entity : mEntities)
+		// Simulate on all workers, drawing below has to stay on this (OpenGL) thread
+		coordinator->ParallelEach<Particle>([&](EntityID, Particle& particle)
 		{
-			Particle& particle = *coordinator->GetComponent<Particle>(entity);
 			particle.Update(deltaTime, glm::vec3{ 0.f, 0.f, -3.f }, rotationT);
+		});
 
+		Renderer::BeginCubeBatch();
+
+		coordinator->Each<Particle>([&](EntityID, Particle& particle)
+		{
 			for (int i = 0; i < particle.particles.size(); ++i)
 			{
 				if (particle.particles[i].isActive == true)
@@ -90,7 +93,7 @@ namespace Engine
 			}
 
 			Renderer::DrawCube(position, {0.1f, 0.1f, 0.1f}, rotationT, particle.texobj_hdl);
-		}
+		});
 
 		Renderer::EndCubeBatch();
 		Renderer::FlushCube();
@@ -8,9 +8,6 @@
 \brief
   This file contains the implementation of TransformSystem class.
 
-  It is just for me to play around and test whatever I am implementing at the
-  moment.
-
   Copyright (C) 2022 DigiPen Institure of Technology.
   Reproduction or disclosure of this file or its contents
   without the prior written consent of DigiPen Institute of
@@ -19,31 +16,203 @@
 /******************************************************************************/
 #include "include/ECS/System/TransformSystem.hpp"
 #include "include/ECS/Component/Transform.hpp"
+#include "include/ECS/Architecture/Coordinator.hpp"
 
-#include <iostream>
+#include <algorithm>
 
 namespace Engine
 {
-	void TransformSystem::Init()
+	namespace
 	{
-		for(auto entity : mEntities)
+		// Default Transforms have a zero quaternion, which is treated as no rotation
+		glm::quat ValidRotation(const glm::quat& q)
 		{
-			// do nothing
+			return glm::dot(q, q) > 0.f ? q : glm::quat{ 1.f, 0.f, 0.f, 0.f };
 		}
 	}
 
+
+	void TransformSystem::Init()
+	{
+	}
+
+
 	void TransformSystem::Update()
 	{
-		std::cout << "entities: ";
-		for (auto entity : mEntities)
+		// World transforms need the coordinator, see Update(Coordinator*, float)
+	}
+
+
+	void TransformSystem::Update(Coordinator* coordinator, float deltaTime)
+	{
+		UNUSED(deltaTime);
+
+		const Hierarchy& hierarchy = coordinator->GetHierarchy();
+		std::span<const EntityID> order = hierarchy.GetOrder();
+
+		// Entities whose Transform or parent changed, their whole subtrees are recomputed
+		mDirtyRoots.clear();
+		coordinator->Each<const Transform>(Changed<Transform>{ mLastRunTick }, [&](EntityID e, const Transform&)
+		{
+			mDirtyRoots.emplace_back(hierarchy.GetNode(e).index);
+		});
+		for (const Hierarchy::Change& change : hierarchy.GetChanges(mLastRunTick))
+		{
+			if (hierarchy.Contains(change.entity))
+			{
+				mDirtyRoots.emplace_back(hierarchy.GetNode(change.entity).index);
+			}
+		}
+		std::sort(mDirtyRoots.begin(), mDirtyRoots.end());
+
+		mSerial.clear();
+		mBatches.clear();
+
+		constexpr std::size_t grain = JobSystem::GrainSize<Transform>();
+		std::size_t end = 0; // End of the last subtree added
+		for (std::size_t position : mDirtyRoots)
+		{
+			// Already part of an earlier dirty subtree (Or a duplicate)
+			if (position < end)
+			{
+				continue;
+			}
+
+			end = position + hierarchy.GetNode(order[position]).size;
+			Split(hierarchy, order[position], grain);
+		}
+
+		// Only the positions visited below are written, before they are read
+		if (mNearest.size() < order.size())
+		{
+			mNearest.resize(order.size());
+		}
+
+		// Ancestors of the batches, in order so parents are before children
+		for (std::size_t position : mSerial)
 		{
-			// do nothing
-			std::cout << entity << std::endl;
+			// Parents of serial entities are serial too, unless it is a dirty root
+			const EntityID parent = hierarchy.GetParent(order[position]);
+			const std::size_t parentPosition = parent == INVALID_ENTITY ? 0 : hierarchy.GetNode(parent).index;
+			const bool serialParent = parent != INVALID_ENTITY && std::binary_search(mSerial.begin(), mSerial.end(), parentPosition);
+
+			UpdateEntity(coordinator, hierarchy, position,
+				serialParent ? mNearest[parentPosition] : FindParent(coordinator, hierarchy, order[position]));
 		}
+
+		coordinator->GetJobSystem().ParallelFor(mBatches.size(), 1, [&](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t b = begin; b < end; ++b)
+			{
+				const Batch& batch = mBatches[b];
+				for (std::size_t position = batch.begin; position < batch.end; ++position)
+				{
+					// Parents inside the batch were computed just before, only the subtree roots search their ancestors
+					const EntityID parent = hierarchy.GetParent(order[position]);
+					if (parent != INVALID_ENTITY && hierarchy.GetNode(parent).index >= batch.begin)
+					{
+						UpdateEntity(coordinator, hierarchy, position, mNearest[hierarchy.GetNode(parent).index]);
+					}
+					else
+					{
+						UpdateEntity(coordinator, hierarchy, position, FindParent(coordinator, hierarchy, order[position]));
+					}
+				}
+			}
+		});
 	}
 
+
 	void TransformSystem::Destroy()
 	{
-		
+		mDirtyRoots.clear();
+		mSerial.clear();
+		mBatches.clear();
+		mNearest.clear();
+	}
+
+
+	void TransformSystem::ComputeWorld(Transform& transform, const Transform* parent)
+	{
+		const glm::quat rotation = ValidRotation(transform.rot_q);
+
+		if (parent)
+		{
+			transform.worldRotation = transform.isOverrideRotation ? rotation : parent->worldRotation * rotation;
+			transform.worldScale = transform.isOverrideScale ? transform.scale : parent->worldScale * transform.scale;
+			transform.worldPosition = transform.isOverridePosition ? transform.position :
+				parent->worldPosition + parent->worldRotation * (parent->worldScale * transform.position);
+		}
+		else
+		{
+			transform.worldRotation = rotation;
+			transform.worldScale = transform.scale;
+			transform.worldPosition = transform.position;
+		}
+
+		// Translation * Rotation * Scale
+		glm::mat4 matrix = glm::mat4_cast(transform.worldRotation);
+		matrix[0] *= transform.worldScale.x;
+		matrix[1] *= transform.worldScale.y;
+		matrix[2] *= transform.worldScale.z;
+		matrix[3] = glm::vec4(transform.worldPosition, 1.f);
+		transform.worldMatrix = matrix;
+	}
+
+
+	void TransformSystem::Split(const Hierarchy& hierarchy, EntityID e, std::size_t grain)
+	{
+		const Hierarchy::Node& node = hierarchy.GetNode(e);
+
+		if (node.size <= grain)
+		{
+			// Consecutive small subtrees share a batch
+			if (!mBatches.empty() && mBatches.back().end == node.index && mBatches.back().end - mBatches.back().begin + node.size <= grain)
+			{
+				mBatches.back().end += node.size;
+			}
+			else
+			{
+				mBatches.emplace_back(Batch{ node.index, node.index + node.size });
+			}
+			return;
+		}
+
+		mSerial.emplace_back(node.index);
+		for (EntityID child = node.firstChild; child != INVALID_ENTITY; child = hierarchy.GetNextSibling(child))
+		{
+			Split(hierarchy, child, grain);
+		}
+	}
+
+
+	const Transform* TransformSystem::FindParent(Coordinator* coordinator, const Hierarchy& hierarchy, EntityID e)
+	{
+		for (EntityID ancestor = hierarchy.GetParent(e); ancestor != INVALID_ENTITY; ancestor = hierarchy.GetParent(ancestor))
+		{
+			if (coordinator->HasComponent<Transform>(ancestor))
+			{
+				return coordinator->GetComponent<const Transform>(ancestor);
+			}
+		}
+		return nullptr;
+	}
+
+
+	void TransformSystem::UpdateEntity(Coordinator* coordinator, const Hierarchy& hierarchy, std::size_t position, const Transform* parent)
+	{
+		const EntityID e = hierarchy.GetOrder()[position];
+
+		// Entities without a Transform are skipped, their children use the nearest ancestor with one
+		if (!coordinator->HasComponent<Transform>(e))
+		{
+			mNearest[position] = parent;
+			return;
+		}
+
+		// Stamped as changed, so systems after this one see the new world values
+		Transform* transform = coordinator->GetComponent<Transform>(e);
+		ComputeWorld(*transform, parent);
+		mNearest[position] = transform;
 	}
 }
@@ -0,0 +1,203 @@
+/******************************************************************************/
+/*!
+\file       JobSystem.cpp
+\author     Chia Yi Da
+\param      c.yida
+\param      GAM 350
+\date       17 October 2026
+\brief
+  This file contains the implementation of JobSystem class.
+
+  Copyright (C) 2026 DigiPen Institure of Technology.
+  Reproduction or disclosure of this file or its contents
+  without the prior written consent of DigiPen Institute of
+  Technology is prohibited.
+*/
+/******************************************************************************/
+#include "include/Job/JobSystem.hpp"
+
+namespace Engine
+{
+	namespace
+	{
+		// Job system and deque index of the worker running on this thread (nullptr if not a worker)
+		thread_local const JobSystem* tOwner = nullptr;
+		thread_local std::size_t tWorkerIndex = 0;
+	}
+
+
+	JobSystem::JobSystem(std::size_t threadCount)
+	{
+		threadCount = (std::max)(threadCount, std::size_t{ 1 });
+
+		for (std::size_t i = 0; i < threadCount; ++i)
+		{
+			mWorkers.emplace_back(std::make_unique<Worker>());
+		}
+
+		mThreads.reserve(threadCount);
+		for (std::size_t i = 0; i < threadCount; ++i)
+		{
+			mThreads.emplace_back(&JobSystem::WorkerLoop, this, i);
+		}
+	}
+
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock{ mSleepMutex };
+			mStopping = true;
+		}
+		mSleepCondition.notify_all();
+
+		for (std::thread& thread : mThreads)
+		{
+			thread.join();
+		}
+	}
+
+
+	void JobSystem::Run(Job job, JobCounter* counter)
+	{
+		if (counter)
+		{
+			counter->count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		const std::size_t index = tOwner == this ? tWorkerIndex : mNextWorker.fetch_add(1, std::memory_order_relaxed) % mWorkers.size();
+		{
+			Worker& worker = *mWorkers[index];
+			std::lock_guard<std::mutex> lock{ worker.mutex };
+			worker.tasks.emplace_back(Task{ std::move(job), counter });
+		}
+
+		{
+			std::lock_guard<std::mutex> lock{ mSleepMutex };
+			mPending.fetch_add(1, std::memory_order_relaxed);
+		}
+		mSleepCondition.notify_one();
+	}
+
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			// Remaining jobs are being run by other threads
+			if (!TryRunJob())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+
+	bool JobSystem::TryRunJob()
+	{
+		Task task{};
+		const std::size_t index = tOwner == this ? tWorkerIndex : mNextWorker.load(std::memory_order_relaxed) % mWorkers.size();
+		if (!TryGetTask(index, task))
+		{
+			return false;
+		}
+
+		Execute(task);
+		return true;
+	}
+
+
+	std::size_t JobSystem::GetThreadCount() const
+	{
+		return mThreads.size();
+	}
+
+
+	std::size_t JobSystem::GetThreadIndex() const
+	{
+		return tOwner == this ? tWorkerIndex + 1 : 0;
+	}
+
+
+	std::size_t JobSystem::DefaultThreadCount()
+	{
+		const std::size_t hardware = std::thread::hardware_concurrency();
+		return hardware > 1 ? hardware - 1 : 1;
+	}
+
+
+	void JobSystem::WorkerLoop(std::size_t index)
+	{
+		tOwner = this;
+		tWorkerIndex = index;
+
+		while (true)
+		{
+			Task task{};
+			if (TryGetTask(index, task))
+			{
+				Execute(task);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock{ mSleepMutex };
+			mSleepCondition.wait(lock, [this]() { return mStopping || mPending.load(std::memory_order_relaxed) > 0; });
+
+			// Remaining jobs are still run before stopping
+			if (mStopping && mPending.load(std::memory_order_relaxed) == 0)
+			{
+				return;
+			}
+		}
+	}
+
+
+	bool JobSystem::TryGetTask(std::size_t index, Task& task)
+	{
+		if (mPending.load(std::memory_order_relaxed) == 0)
+		{
+			return false;
+		}
+
+		// Own deque first (Most recently queued)
+		{
+			Worker& worker = *mWorkers[index];
+			std::lock_guard<std::mutex> lock{ worker.mutex };
+			if (!worker.tasks.empty())
+			{
+				task = std::move(worker.tasks.back());
+				worker.tasks.pop_back();
+				mPending.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		// Steal the oldest job of another deque
+		for (std::size_t i = 1; i < mWorkers.size(); ++i)
+		{
+			Worker& victim = *mWorkers[(index + i) % mWorkers.size()];
+			std::lock_guard<std::mutex> lock{ victim.mutex };
+			if (!victim.tasks.empty())
+			{
+				task = std::move(victim.tasks.front());
+				victim.tasks.pop_front();
+				mPending.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+
+	void JobSystem::Execute(Task& task)
+	{
+		task.job();
+
+		if (task.counter)
+		{
+			task.counter->count.fetch_sub(1, std::memory_order_release);
+		}
+	}
+
+} // end of namespace
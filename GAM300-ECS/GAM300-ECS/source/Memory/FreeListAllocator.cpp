@@ -141,6 +141,12 @@ void FreeListAllocator::Free(void* ptr)
         it = it->nextNode;
     }
 
+    // Freed block is after every free block (or free list is empty), insert at the end
+    if (it == nullptr)
+    {
+        m_freeList.insert(itPrev, freeNode);
+    }
+
     m_used -= freeNode->data.blockSize;
 
     // Merge contiguous nodes
@@ -107,8 +107,7 @@
 													JsonToInstance(t, component_json_value);\
 													if (coordinator->HasComponent<type>(*entity))\
 													{\
-														type* ptr = coordinator->GetComponent<type>(*entity);\
-														*ptr = t;\
+														coordinator->ReplaceComponent<type>(entity->GetEntityID(), t);\
 													}\
 													else\
 													{\
@@ -244,7 +243,7 @@ namespace Engine
 		// Serialise root entity first. Parent will be nothing -> Reset back afterwards
 		Entity& entity_h = *coordinator->GetEntity(ids[0]);
 		EntityID parent_id = entity_h.GetParent();
-		entity_h.SetParentID(MAX_ENTITIES + 1);
+		entity_h.SetParentID(INVALID_ENTITY);
 		entity_h.SetPrefab(filename);
 		names.emplace_back(entity_h.GetEntityName());
 
@@ -293,23 +292,24 @@ namespace Engine
 		}
 		Serializer::StringToJson(filename, js);
 
-		// Create a new set of entities and delete the "old" one (ID to be iterative)
+		// Create a new set of entities and delete the "old" one
 		// Reset parent ID back (For Parent-Child container)
 		entity_h.SetParentID(parent_id);
 		coordinator->DestroyEntity(id);
 
 		EntityID entity_id_new = CreateEntityPrefab(coordinator, tagmanager, filename);
 		coordinator->AddToPrefabMap(filename, entity_id_new);
-		if (parent_id <= MAX_ENTITIES)
+		if (parent_id != INVALID_ENTITY)
 		{
 			coordinator->ToChild(parent_id, entity_id_new);
 		}
 
-		// Reset name
-		for (int i = 0; i < names.size(); ++i)
+		// Reset name, new entities are in the same order as ids (IDs are not sequential)
+		std::vector<EntityID> ids_new{};
+		coordinator->GetAllChildren(ids_new, entity_id_new);
+		for (int i = 0; i < names.size() && i < ids_new.size(); ++i)
 		{
-			Entity& entity_updated = *coordinator->GetEntity(entity_id_new + i);
-			entity_updated.SetEntityName(names[i]);
+			coordinator->SetEntityName(ids_new[i], names[i]);
 		}
 	}
 
@@ -335,7 +335,7 @@ namespace Engine
 		{
 			LOG_WARNING("Parse Error: PREFAB file either does not exist or has formatting issues", e.what());
 			UNUSED(e);
-			return MAX_ENTITIES + 1;
+			return INVALID_ENTITY;
 		}
 
 		std::vector<EntityID> ids{};
@@ -345,26 +345,14 @@ namespace Engine
 			if (!(object.contains("0Entity")))
 			{
 				LOG_ERROR("Object does not have an Entity! Json file will NOT be deserialized!");
-				return MAX_ENTITIES + 1;
+				return INVALID_ENTITY;
 			}
 
 			// Always deserialize entity first, set its properties, then proceed.
 			// Get correct naming before creating entity
 			std::string entity_name = object["0Entity"]["name"];
-			std::string duplicate_name{};
+			std::string duplicate_name = coordinator->GetUniqueName(entity_name + "(");
 
-			int i = 1;
-			for (int size = 0; size < coordinator->GetEntities().size(); ++size)
-			{
-				duplicate_name = entity_name + "(" + std::to_string(i) + ")";
-
-				if (coordinator->GetEntities()[size].GetEntityName() == duplicate_name)
-				{
-					// Increament till highest value, reset back loop to check again.
-					++i;
-					size = 0;
-				}
-			}
 			EntityID entity_id = coordinator->CreateEntity(duplicate_name);
 			Entity* entity = coordinator->GetEntity(entity_id);
 			entity->SetParentID(object["0Entity"]["parent"]);
@@ -392,21 +380,20 @@ namespace Engine
 		}
 
 		// Skip ids[0] as parent id will always be invalid 
-		EntityID offset = ids[0];
-		
+		coordinator->GetEntity(ids[0])->SetParentID(INVALID_ENTITY);
 		coordinator->AddToPrefabMap(filename, ids[0]);
 
-		// Once prefab entities are deserialised, set parent ids accordingly.
+		// Once prefab entities are deserialised, set parent ids accordingly (Parent id is index in ids).
 		for (int i = 1; i < ids.size(); ++i)
 		{
 			EntityID id = ids[i];
 			Entity* entity = coordinator->GetEntity(id);
 
-			coordinator->ToChild(offset + entity->GetParent(), id);
+			coordinator->ToChild(ids[entity->GetParent()], id);
 		}
 
 		// Return head entity id
-		return offset;
+		return ids[0];
 	}
 
 
@@ -456,13 +443,15 @@ namespace Engine
 		}
 
 		// Loop through each object in writer
+		std::vector<EntityID> ids{};
 		for (auto& object : writer)
 		{
 			// Always deserialize entity first, set its properties, then proceed
 			EntityID entity_id = coordinator->CreateEntity(object["0Entity"]["name"]);
+			ids.emplace_back(entity_id);
 			Entity* entity = coordinator->GetEntity(entity_id);
 			entity->SetParentID(object["0Entity"]["parent"]);
-			entity->SetIs_Active(object["0Entity"]["isActive"]);
+			coordinator->SetActive(entity_id, object["0Entity"]["isActive"]);
 
 			if (std::string tag = object["0Entity"]["tag"]; tag != "")
 			{
@@ -489,14 +478,18 @@ namespace Engine
 			}
 		}
 
-		for (auto& entity : coordinator->GetEntities())
+		// Parent id is index of the parent in the scene file
+		for (EntityID id : ids)
 		{
-			if (entity.GetParent() > MAX_ENTITIES)
+			Entity* entity = coordinator->GetEntity(id);
+			if (entity->GetParent() >= ids.size())
 			{
+				// Root entity (Older scene files use 5001 as no parent)
+				entity->SetParentID(INVALID_ENTITY);
 				continue;
 			}
 
-			coordinator->ToChild(entity.GetParent(), entity.GetEntityID());
+			coordinator->ToChild(ids[entity->GetParent()], id);
 		}
 	}
 
@@ -519,16 +512,20 @@ namespace Engine
 			return;
 		}
 
+		// Entities of the prefab instance, in the same order as the prefab file
+		std::vector<EntityID> ids{};
+		coordinator->GetAllChildren(ids, id);
+
 		// Loop through each object in writer
 		int index = 0;
 		for (auto& object : writer)
 		{
 			// To get the correct entity
-			if (!(coordinator->EntityExists(id + index)))
+			if (index >= ids.size())
 			{
-				continue;
+				break;
 			}
-			Entity* entity = coordinator->GetEntity(id + index);
+			Entity* entity = coordinator->GetEntity(ids[index]);
 
 			// Get all component names, remove "Entity"
 			auto componentList = object.get<json::object_t>();
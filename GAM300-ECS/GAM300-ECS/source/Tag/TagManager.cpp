@@ -107,9 +107,10 @@ namespace Engine
 		// Deleting tag from container
 		mTags.erase(key);
 
+		const StringID keyID = StringTable::Find(key);
 		for (auto& entity : coordinator->GetEntities())
 		{
-			if (key == entity.GetKeyTag())
+			if (keyID == entity.GetKeyTagID())
 			{
 				entity.SetKeyTag(std::string{});
 				coordinator->SetTag(entity, Tag{});
@@ -139,11 +140,12 @@ namespace Engine
 		}
 
 		Tag updated_tag = tag;
-		for (auto entity : coordinator->GetEntities())
+		const StringID keyID = StringTable::Find(key);
+		for (const auto& entity : coordinator->GetEntities())
 		{
-			if (key == entity.GetKeyTag())
+			if (keyID == entity.GetKeyTagID())
 			{
-				coordinator->SetTag(entity, updated_tag);
+				coordinator->SetTag(entity.GetEntityID(), updated_tag);
 			}
 		}
 	}
@@ -164,11 +166,12 @@ namespace Engine
 		tag.set(layer_, false);
 
 		Tag updated_tag = tag;
-		for (auto entity : coordinator->GetEntities())
+		const StringID keyID = StringTable::Find(key);
+		for (const auto& entity : coordinator->GetEntities())
 		{
-			if (key == entity.GetKeyTag())
+			if (keyID == entity.GetKeyTagID())
 			{
-				coordinator->SetTag(entity, updated_tag);
+				coordinator->SetTag(entity.GetEntityID(), updated_tag);
 			}
 		}
 	}
@@ -224,10 +227,10 @@ namespace Engine
 
 	void TagManager::RefreshTags(Coordinator* coordinator)
 	{
-		for (auto entity : coordinator->GetEntities())
+		for (const auto& entity : coordinator->GetEntities())
 		{
 			Tag tag = mTags[entity.GetKeyTag()];
-			coordinator->SetTag(entity, tag);
+			coordinator->SetTag(entity.GetEntityID(), tag);
 		}
 	}
 
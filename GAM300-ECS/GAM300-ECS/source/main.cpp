@@ -221,7 +221,7 @@ int main()
 			particle->isLooping = true;
 		}
 
-		particleSystem->Update(&gCoordinator, deltaTime);
+		gCoordinator.UpdateSystems(deltaTime);
 
 		// Resets mouse position every frame
 		glfwSetCursorPos(window, lastX, lastY);